@@ -9,18 +9,44 @@ let package = Package(
         .iOS(.v14)
     ],
     products: [
+        // Every feature, plus capture replay and the batch pipeline.
         .library(
             name: "CryptonetPackage",
             targets: ["CryptonetPackage"]),
+        // One feature each, for apps that only use part of the SDK.
+        .library(
+            name: "CryptonetFace",
+            targets: ["CryptonetFace"]),
+        .library(
+            name: "CryptonetAge",
+            targets: ["CryptonetAge"]),
+        .library(
+            name: "CryptonetDocument",
+            targets: ["CryptonetDocument"]),
     ],
     targets: [
-        .target(name: "CryptonetPackage",
+        .target(name: "CryptonetCore",
                 dependencies: [
                     .target(
                         name: "privid_fhe"
                     )
                 ]
         ),
+        .target(name: "CryptonetFace",
+                dependencies: ["CryptonetCore", "privid_fhe"]
+        ),
+        .target(name: "CryptonetAge",
+                dependencies: ["CryptonetCore", "privid_fhe"]
+        ),
+        .target(name: "CryptonetDocument",
+                dependencies: ["CryptonetCore", "privid_fhe"]
+        ),
+        .target(name: "CryptonetPackage",
+                dependencies: ["CryptonetCore", "CryptonetFace", "CryptonetAge", "CryptonetDocument"]
+        ),
+        .testTarget(name: "CryptonetCoreTests",
+                    dependencies: ["CryptonetCore", "CryptonetFace"]
+        ),
         .binaryTarget(name: "privid_fhe", path: "./privid_fhe.xcframework")
     ]
 )
@@ -0,0 +1,85 @@
+import UIKit
+import privid_fhe
+import CryptonetCore
+
+// Age estimation.
+public extension CryptonetPackage {
+    func estimateAge(image: UIImage, config: EstimageAgeConfig) -> Result<String, Error> {
+        estimateAge(images: [image], config: config)[0]
+    }
+    
+    /// Estimates the age on every image of a list, one library call per image, and returns one result
+    /// per image, in order. A convenience over calling `estimateAge(image:config:)` in a loop: the
+    /// library has no batched age estimation, so this is no faster.
+    func estimateAge(images: [UIImage], config: EstimageAgeConfig) -> [Result<String, Error>] {
+        estimateAge(images: images, config: config, task: nil)
+    }
+    
+    internal func estimateAge(images: [UIImage], config: EstimageAgeConfig, task: CryptonetTask?) -> [Result<String, Error>] {
+        guard let configData = try? JSONEncoder().encode(config) else {
+            return images.map { _ in .failure(CryptonetError.failed) }
+        }
+        
+        let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+        let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+        // A liveness verdict is never reused for another frame: the hash cannot tell a live face from a
+        // picture of it.
+        let cache = config.skipAntispoof ? resultCache : nil
+        
+        let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+        let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+        
+        defer {
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+        }
+        
+        return images.map { (image) -> Result<String, Error> in
+            // The rest of a cancelled or late batch is not even converted.
+            if let reason = task?.stopReason {
+                return .failure(reason)
+            }
+            
+            let tier = latencyBudgetController.tier(for: .estimateAge, budget: config.latencyBudget)
+            
+            // Looked up before the frame is converted.
+            let cacheKey = cache?.key(for: .estimateAge, config: userConfig as String, image: image)
+            if let cacheKey = cacheKey, let cached: String = cache?.value(for: cacheKey) {
+                return .success(cached)
+            }
+            
+            guard let bitmap = convertImageToRgbaRawBitmap(image: image, targetSize: tier.targetSize) else {
+                return .failure(CryptonetError.failed)
+            }
+            
+            let imageWidth = bitmap.width
+            let imageHeight = bitmap.height
+            let byteImageArray = bitmap.bytes
+            
+            bufferOut.pointee = nil
+            
+            let status = callLibrary(.estimateAge, config: userConfig, images: [bitmap], task: task, tier: tier, budget: config.latencyBudget) { session in
+                privid_estimate_age(session,
+                                    byteImageArray,
+                                    imageWidth,
+                                    imageHeight,
+                                    userConfigPointer,
+                                    Int32(userConfig.length),
+                                    bufferOut,
+                                    lengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            let result = resultJSON(outputString, inputTier: tier, budget: config.latencyBudget)
+            if let cacheKey = cacheKey {
+                cache?.insert(result, for: cacheKey)
+            }
+            return .success(result)
+        }
+    }
+}
@@ -0,0 +1,20 @@
+import UIKit
+import CryptonetCore
+
+/// Asynchronous variants of the age calls, run on the executor of the instance.
+public extension CryptonetPackage {
+    @discardableResult
+    func estimateAge(image: UIImage, config: EstimageAgeConfig, deadline: DispatchTime? = nil,
+                     completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.estimateAge(images: [image], config: config, task: $0)[0] }, completion: completion)
+    }
+    
+    @discardableResult
+    func estimateAge(images: [UIImage], config: EstimageAgeConfig, deadline: DispatchTime? = nil,
+                     completion: @escaping ([Result<String, Error>]) -> Void) -> CryptonetTask {
+        perform(deadline: deadline,
+                { self.estimateAge(images: images, config: config, task: $0) },
+                cancelled: { error in images.map { _ in .failure(error) } },
+                completion: completion)
+    }
+}
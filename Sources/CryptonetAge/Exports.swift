@@ -0,0 +1,2 @@
+// Importing a feature module is enough to create sessions and call its operations.
+@_exported import CryptonetCore
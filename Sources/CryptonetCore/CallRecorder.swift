@@ -0,0 +1,87 @@
+import Foundation
+import CryptoKit
+
+/// Appends every library call to a capture file. Records are encoded and written on a private queue,
+/// so the calls themselves only pay for handing their inputs over. The file can hold face pixels, so it
+/// is only readable while the device is unlocked; a failed write, e.g. a full disk, ends the capture.
+///
+/// Layout, little-endian: the 8-byte `CNCAP001` magic, then one record per call:
+/// operation (UInt8 length + UTF-8), timestamp (Float64, seconds since 1970), latency (Float64, seconds),
+/// status (Int32), config (UInt32 length + UTF-8 JSON), image count (UInt8), and per image:
+/// width (Int32), height (Int32), SHA-256 of the RGBA pixels (32 bytes), pixels (UInt32 length + bytes,
+/// length 0 when pixels are not captured).
+package final class CallRecorder {
+    static let magic = Data("CNCAP001".utf8)
+    
+    private let fileHandle: FileHandle
+    private let includesPixels: Bool
+    private let queue = DispatchQueue(label: "com.privateid.cryptonet.recorder")
+    private var isClosed = false
+    
+    package init(url: URL, includesPixels: Bool) throws {
+        guard FileManager.default.createFile(atPath: url.path,
+                                             contents: CallRecorder.magic,
+                                             attributes: [.protectionKey: FileProtectionType.complete]) else {
+            throw CryptonetError.failed
+        }
+        self.fileHandle = try FileHandle(forWritingTo: url)
+        self.fileHandle.seekToEndOfFile()
+        self.includesPixels = includesPixels
+    }
+    
+    func record(_ operation: CryptonetOperation, config: String, images: [RgbaRawBitmap],
+                latency: TimeInterval, status: Int32) {
+        let timestamp = Date().timeIntervalSince1970
+        
+        queue.async {
+            // A call that picked up the recorder just before it was stopped is dropped.
+            guard !self.isClosed else { return }
+            
+            var data = Data()
+            data.appendString(operation.rawValue, lengthType: UInt8.self)
+            data.appendInteger(timestamp.bitPattern)
+            data.appendInteger(latency.bitPattern)
+            data.appendInteger(UInt32(bitPattern: status))
+            data.appendString(config, lengthType: UInt32.self)
+            data.appendInteger(UInt8(images.count))
+            for image in images {
+                data.appendInteger(UInt32(bitPattern: image.width))
+                data.appendInteger(UInt32(bitPattern: image.height))
+                data.append(contentsOf: SHA256.hash(data: image.bytes))
+                if self.includesPixels {
+                    data.appendInteger(UInt32(image.bytes.count))
+                    data.append(contentsOf: image.bytes)
+                } else {
+                    data.appendInteger(UInt32(0))
+                }
+            }
+            do {
+                try self.fileHandle.write(contentsOf: data)
+            } catch {
+                self.isClosed = true
+                try? self.fileHandle.close()
+            }
+        }
+    }
+    
+    /// Waits for the pending records and closes the file.
+    package func close() {
+        queue.sync {
+            guard !isClosed else { return }
+            isClosed = true
+            fileHandle.closeFile()
+        }
+    }
+}
+
+extension Data {
+    mutating func appendInteger<T: FixedWidthInteger>(_ value: T) {
+        Swift.withUnsafeBytes(of: value.littleEndian) { append(contentsOf: $0) }
+    }
+    
+    mutating func appendString<Length: FixedWidthInteger>(_ string: String, lengthType: Length.Type) {
+        let bytes = Data(string.utf8)
+        appendInteger(Length(bytes.count))
+        append(bytes)
+    }
+}
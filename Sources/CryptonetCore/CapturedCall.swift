@@ -0,0 +1,95 @@
+import Foundation
+
+/// One library call read back from a capture written by `CryptonetPackage.startRecording(to:includesPixels:)`.
+public struct CapturedCall {
+    public let operation: CryptonetOperation
+    public let timestamp: Date
+    public let latency: TimeInterval
+    /// Value returned by the library: a transaction id when positive, a failure otherwise.
+    public let status: Int32
+    /// JSON configuration sent to the library.
+    public let config: String
+    public let images: [CapturedImage]
+}
+
+public struct CapturedImage {
+    public let width: Int
+    public let height: Int
+    public let sha256: Data
+    /// RGBA pixels, `nil` unless the capture included pixels. Multi-frame calls store their frames
+    /// one after the other.
+    public let pixels: Data?
+}
+
+public extension CapturedCall {
+    static func read(from url: URL) throws -> [CapturedCall] {
+        var reader = CaptureReader(data: try Data(contentsOf: url))
+        guard try reader.readBytes(count: CallRecorder.magic.count) == CallRecorder.magic else {
+            throw CryptonetError.failed
+        }
+        
+        var calls: [CapturedCall] = []
+        while !reader.isAtEnd {
+            calls.append(try reader.readCall())
+        }
+        return calls
+    }
+}
+
+private struct CaptureReader {
+    let data: Data
+    var offset = 0
+    
+    var isAtEnd: Bool {
+        offset >= data.count
+    }
+    
+    mutating func readCall() throws -> CapturedCall {
+        guard let operation = CryptonetOperation(rawValue: try readString(lengthType: UInt8.self)) else {
+            throw CryptonetError.failed
+        }
+        let timestamp = Double(bitPattern: try readInteger(UInt64.self))
+        let latency = Double(bitPattern: try readInteger(UInt64.self))
+        let status = Int32(bitPattern: try readInteger(UInt32.self))
+        let config = try readString(lengthType: UInt32.self)
+        
+        var images: [CapturedImage] = []
+        for _ in 0..<Int(try readInteger(UInt8.self)) {
+            let width = Int(Int32(bitPattern: try readInteger(UInt32.self)))
+            let height = Int(Int32(bitPattern: try readInteger(UInt32.self)))
+            let sha256 = try readBytes(count: 32)
+            let pixelCount = Int(try readInteger(UInt32.self))
+            let pixels = pixelCount > 0 ? try readBytes(count: pixelCount) : nil
+            images.append(CapturedImage(width: width, height: height, sha256: sha256, pixels: pixels))
+        }
+        
+        return CapturedCall(operation: operation,
+                            timestamp: Date(timeIntervalSince1970: timestamp),
+                            latency: latency,
+                            status: status,
+                            config: config,
+                            images: images)
+    }
+    
+    mutating func readBytes(count: Int) throws -> Data {
+        guard count >= 0, offset + count <= data.count else { throw CryptonetError.failed }
+        
+        let start = data.startIndex + offset
+        offset += count
+        return data.subdata(in: start..<start + count)
+    }
+    
+    mutating func readInteger<T: FixedWidthInteger & UnsignedInteger>(_ type: T.Type) throws -> T {
+        var value: T = 0
+        for (index, byte) in try readBytes(count: MemoryLayout<T>.size).enumerated() {
+            value |= T(byte) << (index * 8)
+        }
+        return value
+    }
+    
+    mutating func readString<Length: FixedWidthInteger & UnsignedInteger>(lengthType: Length.Type) throws -> String {
+        let bytes = try readBytes(count: Int(try readInteger(Length.self)))
+        guard let string = String(data: bytes, encoding: .utf8) else { throw CryptonetError.failed }
+        return string
+    }
+}
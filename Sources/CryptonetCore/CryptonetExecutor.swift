@@ -0,0 +1,19 @@
+import Foundation
+
+/// Runs the work scheduled by the asynchronous `CryptonetPackage` calls.
+/// Conform your own scheduler to it so the SDK shares your threads instead of competing with them.
+public protocol CryptonetExecutor {
+    func execute(_ work: @escaping () -> Void)
+}
+
+extension DispatchQueue: CryptonetExecutor {
+    public func execute(_ work: @escaping () -> Void) {
+        async(execute: work)
+    }
+}
+
+extension OperationQueue: CryptonetExecutor {
+    public func execute(_ work: @escaping () -> Void) {
+        addOperation(work)
+    }
+}
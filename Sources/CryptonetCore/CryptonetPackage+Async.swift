@@ -0,0 +1,35 @@
+import UIKit
+
+/// Schedules the asynchronous variants of the calls, which each feature module declares next to its
+/// synchronous ones. Every asynchronous call takes an optional `deadline` and returns a `CryptonetTask`.
+/// Work that is cancelled, or whose deadline passed while it was waiting on the executor or for the
+/// session, never reaches the library and completes with `CryptonetError.cancelled` or
+/// `CryptonetError.deadlineExceeded`. The operation gets the task, so it is checked again right before
+/// the library call.
+package extension CryptonetPackage {
+    func perform<Success>(deadline: DispatchTime?,
+                          _ operation: @escaping (CryptonetTask) -> Result<Success, Error>,
+                          completion: @escaping (Result<Success, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, operation, cancelled: { .failure($0) }, completion: completion)
+    }
+    
+    func perform<T>(deadline: DispatchTime?,
+                    _ operation: @escaping (CryptonetTask) -> T,
+                    cancelled: @escaping (Error) -> T,
+                    completion: @escaping (T) -> Void) -> CryptonetTask {
+        let task = CryptonetTask(deadline: deadline)
+        
+        statsRecorder.enqueue()
+        executor.execute {
+            let result: T
+            if let reason = task.stopReason {
+                result = cancelled(reason)
+            } else {
+                result = operation(task)
+            }
+            self.statsRecorder.dequeue()
+            completion(result)
+        }
+        return task
+    }
+}
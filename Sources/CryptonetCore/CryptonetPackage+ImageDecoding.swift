@@ -0,0 +1,40 @@
+import UIKit
+import ImageIO
+
+public extension CryptonetPackage {
+    /// Decodes a JPEG/PNG buffer straight to at most `maxPixelSize` on its longest side. JPEGs are scaled
+    /// while decoding, so the full-resolution bitmap is never created. The result can be passed to any
+    /// operation without being resized again.
+    static func downsampledImage(data: Data, maxPixelSize: CGFloat = 1000) -> UIImage? {
+        let sourceOptions = [kCGImageSourceShouldCache: false] as CFDictionary
+        guard let source = CGImageSourceCreateWithData(data as CFData, sourceOptions) else {
+            return nil
+        }
+        return downsampledImage(source: source, maxPixelSize: maxPixelSize)
+    }
+    
+    /// Same as `downsampledImage(data:maxPixelSize:)`, reading the file from disk without loading it in memory first.
+    static func downsampledImage(url: URL, maxPixelSize: CGFloat = 1000) -> UIImage? {
+        let sourceOptions = [kCGImageSourceShouldCache: false] as CFDictionary
+        guard let source = CGImageSourceCreateWithURL(url as CFURL, sourceOptions) else {
+            return nil
+        }
+        return downsampledImage(source: source, maxPixelSize: maxPixelSize)
+    }
+}
+
+private extension CryptonetPackage {
+    static func downsampledImage(source: CGImageSource, maxPixelSize: CGFloat) -> UIImage? {
+        let thumbnailOptions = [
+            kCGImageSourceCreateThumbnailFromImageAlways: true,
+            kCGImageSourceCreateThumbnailWithTransform: true,
+            kCGImageSourceShouldCacheImmediately: true,
+            kCGImageSourceThumbnailMaxPixelSize: maxPixelSize
+        ] as CFDictionary
+        
+        guard let cgImage = CGImageSourceCreateThumbnailAtIndex(source, 0, thumbnailOptions) else {
+            return nil
+        }
+        return UIImage(cgImage: cgImage)
+    }
+}
@@ -0,0 +1,569 @@
+import UIKit
+import privid_fhe
+
+public enum CryptonetError: Error {
+    case noJSON
+    case failed
+    case cancelled
+    case deadlineExceeded
+}
+
+public class CryptonetPackage {
+    
+    /// - Parameter executor: runs the asynchronous calls. Defaults to `sharedExecutor`, which every instance
+    ///   created without one uses, so adding instances adds no threads.
+    /// - Parameter upscalesSmallImages: scale images smaller than the working size up to it, as the SDK
+    ///   always did. `false` sends them at their own size, which is cheaper, but its effect on accuracy
+    ///   has not been measured.
+    public init(executor: CryptonetExecutor = CryptonetPackage.sharedExecutor, upscalesSmallImages: Bool = true) {
+        self.executor = executor
+        self.upscalesSmallImages = upscalesSmallImages
+    }
+    
+    /// Process-wide executor of the instances created without one. It runs `sharedExecutorWidth`
+    /// operations at a time, whatever the number of instances.
+    public static let sharedExecutor: OperationQueue = {
+        let queue = OperationQueue()
+        queue.name = "com.privateid.cryptonet"
+        queue.qualityOfService = .userInitiated
+        queue.maxConcurrentOperationCount = 1
+        return queue
+    }()
+    
+    /// Operations `sharedExecutor` runs at the same time, `1` by default. Raise it when several instances
+    /// with sessions of their own, or sessions opened with a higher `maxConcurrentCalls`, should run in
+    /// parallel.
+    public static var sharedExecutorWidth: Int {
+        get { sharedExecutor.maxConcurrentOperationCount }
+        set { sharedExecutor.maxConcurrentOperationCount = max(1, newValue) }
+    }
+    
+    deinit {
+        _ = deinitializeSession()
+    }
+
+    private let sessionLock = NSLock()
+    private var session: CryptonetSession?
+    private var sharedSessionSettings: String?
+    private var cache: ResultCache?
+    
+    let executor: CryptonetExecutor
+    let upscalesSmallImages: Bool
+    package let statsRecorder = OperationStatsRecorder()
+    package let latencyBudgetController = LatencyBudgetController()
+    
+    /// Number of asynchronous calls scheduled on the executor that have not completed yet.
+    public var pendingOperationCount: Int {
+        statsRecorder.pendingCount
+    }
+    
+    /// Input tier the next call of `operation` runs at when its config sets a `latencyBudget`.
+    public func inputTier(for operation: CryptonetOperation) -> InputTier {
+        latencyBudgetController.currentTier(for: operation)
+    }
+    
+    /// Latency of the library calls made for `operation` by this instance.
+    public func stats(for operation: CryptonetOperation) -> OperationStats {
+        statsRecorder.stats(for: operation)
+    }
+    
+    /// Returns the last result of `validate` or `estimateAge` when called again with a near-identical
+    /// frame and the same config, without calling the library. Frames are compared by a 64-bit perceptual
+    /// hash of the frame at 9x8 pixels; `tolerance` is the number of bits in which two hashes may differ.
+    /// Two different faces in the same framing can hash alike, and a larger tolerance makes that likelier,
+    /// so a cached result may belong to another person: do not enable the cache for age gating. Calls with
+    /// anti-spoof enabled are never cached.
+    /// Cached results repeat the transaction ids of the calls that produced them. The cache is emptied
+    /// whenever the session is initialized or deinitialized.
+    public func enableResultCache(capacity: Int = 16, tolerance: Int = 0) {
+        sessionLock.lock()
+        cache = ResultCache(capacity: capacity, tolerance: tolerance)
+        sessionLock.unlock()
+    }
+    
+    public func disableResultCache() {
+        sessionLock.lock()
+        cache = nil
+        sessionLock.unlock()
+    }
+    
+    /// Hits and misses since the result cache was enabled or last emptied.
+    public var resultCacheStats: ResultCacheStats {
+        resultCache?.stats ?? ResultCacheStats(hits: 0, misses: 0, count: 0)
+    }
+    
+    /// Directory in Application Support where the library keeps its models between launches.
+    public static var defaultModelsDirectory: URL {
+        let applicationSupport = FileManager.default.urls(for: .applicationSupportDirectory, in: .userDomainMask)[0]
+        return applicationSupport.appendingPathComponent("privid_models", isDirectory: true)
+    }
+    
+    private static let libraryLock = NSLock()
+    private static var isLibraryInitialized = false
+    
+    /// Points the library at a persistent, writable models directory, so models loaded from URLs are
+    /// downloaded once and reused by later launches. Call it once, before the first session is created;
+    /// later calls are ignored.
+    @discardableResult
+    public static func initializeLib(modelsDirectory: URL = CryptonetPackage.defaultModelsDirectory) -> Bool {
+        libraryLock.lock()
+        defer { libraryLock.unlock() }
+        
+        guard !isLibraryInitialized else { return true }
+        
+        var directory = modelsDirectory
+        do {
+            try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+            var resourceValues = URLResourceValues()
+            resourceValues.isExcludedFromBackup = true
+            try directory.setResourceValues(resourceValues)
+        } catch {
+            return false
+        }
+        
+        let modelsPath = NSString(string: directory.path)
+        let modelsPathPointer = UnsafeMutablePointer<CChar>(mutating: modelsPath.utf8String)
+        privid_initialize_lib(modelsPathPointer, Int32(modelsPath.lengthOfBytes(using: String.Encoding.utf8.rawValue)))
+        
+        isLibraryInitialized = true
+        return true
+    }
+    
+    public var version: String {
+        let version = String(cString: privid_get_version(), encoding: .utf8)
+        return version ?? ""
+    }
+    
+    /// - Parameter shared: reuse the session of any other instance initialized with the same settings and
+    ///   `shared: true`, instead of loading the models again. The session is closed when the last of them
+    ///   deinitializes it or is released.
+    /// - Parameter maxConcurrentCalls: how many operations may run on the session at the same time, from
+    ///   any thread or instance sharing it. Further calls wait for a free slot. The library does not
+    ///   document its sessions as reentrant, so the default runs one operation at a time; raise it only
+    ///   with a library build known to be reentrant, and pair it with a concurrent executor or a wider
+    ///   `sharedExecutorWidth`. A shared session keeps the limit it was opened with.
+    public func initializeSession(settings: NSString, shared: Bool = false, maxConcurrentCalls: Int = 1) -> Bool {
+        let open = { () -> CryptonetSession? in
+            CryptonetPackage.openSession(settings: settings).map {
+                CryptonetSession(pointer: $0, maxConcurrentCalls: maxConcurrentCalls)
+            }
+        }
+        let session = shared ? SharedSessionRegistry.shared.acquire(settings: settings as String, open: open) : open()
+        
+        // The new session replaces the current one in a single step, so concurrent calls each close the
+        // session they replaced and none is left open.
+        sessionLock.lock()
+        let replacedSession = self.session
+        let replacedSharedSessionSettings = self.sharedSessionSettings
+        self.session = session
+        self.sharedSessionSettings = shared && session != nil ? settings as String : nil
+        self.cache = cache.map { ResultCache(capacity: $0.capacity, tolerance: $0.tolerance) }
+        sessionLock.unlock()
+        
+        if let replacedSession = replacedSession {
+            CryptonetPackage.closeSession(replacedSession, sharedSettings: replacedSharedSessionSettings)
+        }
+        return session != nil
+    }
+    
+    /// Waits for the operations already running on the session, then closes it. Calls made after this
+    /// returns fail with `CryptonetError.failed`.
+    public func deinitializeSession() -> Result<Bool, Error> {
+        sessionLock.lock()
+        let session = self.session
+        let sharedSessionSettings = self.sharedSessionSettings
+        self.session = nil
+        self.sharedSessionSettings = nil
+        self.cache = cache.map { ResultCache(capacity: $0.capacity, tolerance: $0.tolerance) }
+        sessionLock.unlock()
+        
+        guard let session = session else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        CryptonetPackage.closeSession(session, sharedSettings: sharedSessionSettings)
+        return .success(true)
+    }
+    
+    /// Sets the cycling threshold of the library's billing records.
+    /// - Parameter thresholds: map between billing operation names, as defined by the library's billing
+    ///   reference, and the desired thresholds.
+    public func setBillingRecordThreshold(thresholds: [String: Int]) -> Result<Bool, Error> {
+        do {
+            let configData = try JSONEncoder().encode(thresholds)
+            let billingConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            let billingConfigPointer = UnsafeMutablePointer<CChar>(mutating: billingConfig.utf8String)
+            
+            guard let session = beginSessionCall() else {
+                return .failure(CryptonetError.failed)
+            }
+            defer { session.end() }
+            
+            let isDone = privid_set_billing_record_threshold(session.pointer,
+                                                             billingConfigPointer,
+                                                             Int32(billingConfig.length))
+            return .success(isDone)
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+}
+
+package extension CryptonetPackage {
+    var resultCache: ResultCache? {
+        sessionLock.lock()
+        defer { sessionLock.unlock() }
+        return cache
+    }
+    
+    /// Current session, held open for one operation until `end()` is called on it. `nil` when the
+    /// instance has no session or it is being closed.
+    func beginSessionCall() -> CryptonetSession? {
+        sessionLock.lock()
+        let session = self.session
+        sessionLock.unlock()
+        
+        guard let session = session, session.begin() else { return nil }
+        return session
+    }
+    
+    /// Runs one library call on the current session and records its latency under `operation`, and
+    /// with a `budget` also for the latency budget of `tier`. The session is held for the call only:
+    /// inputs are prepared and outputs read by the caller, so that work never keeps other calls waiting
+    /// for the session. Fails without calling `call` when the instance has no open session, or when
+    /// `task` was cancelled or ran past its deadline while waiting for the session.
+    func callLibrary(_ operation: CryptonetOperation,
+                     config: NSString,
+                     images: [RgbaRawBitmap] = [],
+                     task: CryptonetTask?,
+                     tier: InputTier = .accurate,
+                     budget: TimeInterval? = nil,
+                     _ call: (UnsafeMutableRawPointer) -> Int32) -> Result<Int32, Error> {
+        guard let session = beginSessionCall() else {
+            return .failure(CryptonetError.failed)
+        }
+        defer { session.end() }
+        
+        if let reason = task?.stopReason {
+            return .failure(reason)
+        }
+        
+        let (status, latency) = statsRecorder.measure(operation, config: config, images: images) {
+            call(session.pointer)
+        }
+        latencyBudgetController.record(operation, tier: tier, budget: budget, latency: latency)
+        return .success(status)
+    }
+    
+    /// Adds to a JSON result how the wrapper changed the input of the call:
+    /// - `input_tier`, the tier the call ran at, when it ran under a latency budget. Without a budget
+    ///   every call runs at `.accurate`.
+    /// - `region_of_interest`, when only a region of the frame was sent: its `x`, `y`, `width` and
+    ///   `height` in the whole frame, of `frame_width` by `frame_height` pixels. Adding `x` and `y` to
+    ///   the coordinates in the result gives the coordinates in the whole frame.
+    /// Results the wrapper did not change anything for are returned as they are.
+    func resultJSON(_ json: String,
+                    inputTier: InputTier = .accurate,
+                    budget: TimeInterval? = nil,
+                    region: FrameRegion? = nil) -> String {
+        guard budget != nil || region != nil,
+              var object = (try? JSONSerialization.jsonObject(with: Data(json.utf8))) as? [String: Any] else {
+            return json
+        }
+        
+        if budget != nil {
+            object["input_tier"] = inputTier.name
+        }
+        if let region = region {
+            object["region_of_interest"] = [
+                "x": Double(region.rect.minX),
+                "y": Double(region.rect.minY),
+                "width": Double(region.rect.width),
+                "height": Double(region.rect.height),
+                "frame_width": Double(region.frameSize.width),
+                "frame_height": Double(region.frameSize.height)
+            ]
+        }
+        guard let data = try? JSONSerialization.data(withJSONObject: object) else { return json }
+        return String(decoding: data, as: UTF8.self)
+    }
+    
+    static func closeSession(_ session: CryptonetSession, sharedSettings: String?) {
+        if let settings = sharedSettings {
+            SharedSessionRegistry.shared.release(settings: settings)
+        } else {
+            session.close()
+        }
+    }
+    
+    static func openSession(settings: NSString) -> UnsafeMutableRawPointer? {
+        let settingsPointer = UnsafeMutablePointer<CChar>(mutating: settings.utf8String)
+        let sessionPointer = UnsafeMutablePointer<UnsafeMutableRawPointer?>.allocate(capacity: 1)
+        sessionPointer.initialize(to: nil)
+        defer { sessionPointer.deallocate() }
+        
+        let isDone = privid_initialize_session(settingsPointer,
+                                               UInt32(settings.length),
+                                               sessionPointer)
+        
+        return isDone ? sessionPointer.pointee : nil
+    }
+    
+    /// Orients, downscales and converts the image to RGBA in a single draw, so every call
+    /// touches the pixels only once. Smaller images are scaled up to `targetSize` unless the instance
+    /// was created with `upscalesSmallImages: false`.
+    /// A `regionOfInterest` (normalised, top-left origin) is cut out at the scale of the whole frame,
+    /// so the library only receives the pixels of that region. The bitmap then records where the region
+    /// lies in the frame, see `resultJSON(_:inputTier:budget:region:)`.
+    func convertImageToRgbaRawBitmap(image: UIImage,
+                                     targetSize: CGSize = CGSize(width: 1000, height: 1000),
+                                     regionOfInterest: CGRect? = nil) -> RgbaRawBitmap? {
+        guard let cgImage = orientedCGImage(image: image, targetSize: targetSize) else { return nil }
+        
+        let fit = min(targetSize.width / CGFloat(cgImage.width), targetSize.height / CGFloat(cgImage.height))
+        let ratio = upscalesSmallImages ? fit : min(1.0, fit)
+        guard let regionImage = cropImage(cgImage, to: regionOfInterest) else { return nil }
+        
+        var bitmap = drawRgbaRawBitmap(image: regionImage,
+                                       width: Int(CGFloat(regionImage.width) * ratio),
+                                       height: Int(CGFloat(regionImage.height) * ratio))
+        if let pixelRegion = pixelRegion(of: cgImage, for: regionOfInterest) {
+            let scale = CGAffineTransform(scaleX: ratio, y: ratio)
+            bitmap?.frameRegion = FrameRegion(rect: pixelRegion.applying(scale),
+                                              frameSize: CGSize(width: cgImage.width, height: cgImage.height).applying(scale))
+        }
+        return bitmap
+    }
+    
+    /// Packs several images into one buffer of equally sized RGBA frames, as expected by the multi-image calls.
+    /// Frames take the size of the first one; a frame of another aspect ratio is letterboxed into it, never
+    /// stretched, so the faces keep their proportions.
+    func convertImagesToRgbaRawBitmap(images: [UIImage],
+                                      targetSize: CGSize = CGSize(width: 1000, height: 1000),
+                                      regionOfInterest: CGRect? = nil) -> RgbaRawBitmap? {
+        guard let first = images.first,
+              let firstBitmap = convertImageToRgbaRawBitmap(image: first,
+                                                            targetSize: targetSize,
+                                                            regionOfInterest: regionOfInterest) else {
+            return nil
+        }
+        
+        var bytes = firstBitmap.bytes
+        bytes.reserveCapacity(firstBitmap.bytes.count * images.count)
+        for image in images.dropFirst() {
+            let width = CGFloat(firstBitmap.width)
+            let height = CGFloat(firstBitmap.height)
+            guard let cgImage = orientedCGImage(image: image, targetSize: targetSize),
+                  let regionImage = cropImage(cgImage, to: regionOfInterest) else {
+                return nil
+            }
+            
+            let fit = min(width / CGFloat(regionImage.width), height / CGFloat(regionImage.height))
+            let fittedSize = CGSize(width: CGFloat(regionImage.width) * fit, height: CGFloat(regionImage.height) * fit)
+            let fittedRect = CGRect(x: ((width - fittedSize.width) / 2).rounded(),
+                                    y: ((height - fittedSize.height) / 2).rounded(),
+                                    width: fittedSize.width.rounded(),
+                                    height: fittedSize.height.rounded())
+            guard let bitmap = drawRgbaRawBitmap(image: regionImage,
+                                                 width: Int(width),
+                                                 height: Int(height),
+                                                 in: fittedRect) else {
+                return nil
+            }
+            bytes.append(contentsOf: bitmap.bytes)
+        }
+        
+        return RgbaRawBitmap(bytes: bytes,
+                             width: firstBitmap.width,
+                             height: firstBitmap.height,
+                             frameRegion: firstBitmap.frameRegion)
+    }
+    
+    func cropImage(_ image: CGImage, to regionOfInterest: CGRect?) -> CGImage? {
+        guard regionOfInterest != nil else { return image }
+        
+        guard let pixelRegion = pixelRegion(of: image, for: regionOfInterest) else { return nil }
+        return image.cropping(to: pixelRegion)
+    }
+    
+    /// The pixels of `image` covered by `regionOfInterest`, `nil` when there is no region or it lies
+    /// outside the image.
+    func pixelRegion(of image: CGImage, for regionOfInterest: CGRect?) -> CGRect? {
+        guard let region = regionOfInterest else { return nil }
+        
+        let width = CGFloat(image.width)
+        let height = CGFloat(image.height)
+        let pixelRegion = CGRect(x: region.minX * width,
+                                 y: region.minY * height,
+                                 width: region.width * width,
+                                 height: region.height * height)
+            .integral
+            .intersection(CGRect(x: 0, y: 0, width: width, height: height))
+        
+        return pixelRegion.isEmpty ? nil : pixelRegion
+    }
+    
+    func orientedCGImage(image: UIImage, targetSize: CGSize) -> CGImage? {
+        if image.imageOrientation == .up, let cgImage = image.cgImage {
+            return cgImage
+        }
+        
+        // Rotated and CIImage-backed images are normalised by UIKit while downscaling. `resizeImage` draws
+        // at scale 1, so the size is in pixels: a @3x image keeps the resolution it has when `.up`.
+        let pixelSize = CGSize(width: image.size.width * image.scale, height: image.size.height * image.scale)
+        return image.resizeImage(targetSize: CGSize(width: min(targetSize.width, pixelSize.width),
+                                                    height: min(targetSize.height, pixelSize.height)))?.cgImage
+    }
+    
+    /// Draws `image` into `rect` of a black `width` by `height` bitmap, or over all of it without `rect`.
+    func drawRgbaRawBitmap(image: CGImage, width: Int, height: Int, in rect: CGRect? = nil) -> RgbaRawBitmap? {
+        guard width > 0, height > 0 else { return nil }
+        
+        let bitsPerComponent = 8
+        let bytesPerPixel = 4
+        
+        var rawData = [UInt8](repeating: 0, count: width * height * bytesPerPixel)
+        
+        let context = CGContext(
+            data: &rawData, width: width, height: height,
+            bitsPerComponent: bitsPerComponent, bytesPerRow: width * bytesPerPixel,
+            space: CGColorSpaceCreateDeviceRGB(), bitmapInfo: CGImageAlphaInfo.noneSkipLast.rawValue)
+        
+        context?.interpolationQuality = .medium
+        context?.draw(image, in: rect ?? CGRect(x: 0, y: 0, width: width, height: height))
+        
+        return RgbaRawBitmap(bytes: rawData, width: Int32(width), height: Int32(height))
+    }
+    
+    /// Allocates an image out-parameter only when the crop is wanted; the library skips producing crops passed as NULL.
+    func allocateImageOut(isRequested: Bool) -> UnsafeMutablePointer<UnsafeMutablePointer<UInt8>?>? {
+        guard isRequested else { return nil }
+        
+        let imageOut = UnsafeMutablePointer<UnsafeMutablePointer<UInt8>?>.allocate(capacity: 1)
+        imageOut.initialize(to: nil)
+        return imageOut
+    }
+    
+    /// Copies a crop returned by the library into a `UIImage` and releases both the crop and its out-parameter.
+    func takeImage(from imageOut: UnsafeMutablePointer<UnsafeMutablePointer<UInt8>?>?, info: Info?) -> UIImage? {
+        defer { releaseImageOut(imageOut) }
+        
+        return createImageFromRawData(rawData: imageOut?.pointee,
+                                      width: info?.width,
+                                      height: info?.height,
+                                      channels: info?.channels ?? 4)
+    }
+    
+    /// Like `takeImage(from:info:)` for crops whose size has no fixed place in the result: the first
+    /// image `info` in `json` whose width, height and channels match the size of the crop is used, and a
+    /// crop that is not raw pixels is decoded as an encoded image.
+    func takeImage(from imageOut: UnsafeMutablePointer<UnsafeMutablePointer<UInt8>?>?, length: Int32, json: String?) -> UIImage? {
+        defer { releaseImageOut(imageOut) }
+        
+        guard let buffer = imageOut?.pointee, length > 0 else { return nil }
+        
+        if let json = json, let info = imageInfo(in: json, byteCount: Int(length)) {
+            return createImageFromRawData(rawData: buffer,
+                                          width: info.width,
+                                          height: info.height,
+                                          channels: info.channels ?? 4)
+        }
+        return UIImage(data: Data(bytes: buffer, count: Int(length)))
+    }
+    
+    func imageInfo(in json: String, byteCount: Int) -> Info? {
+        func search(_ value: Any) -> Info? {
+            if let dictionary = value as? [String: Any] {
+                // Without `channels` the crop is taken to be RGBA.
+                if let info = dictionary["info"] as? [String: Any],
+                   let width = info["width"] as? Double, let height = info["height"] as? Double,
+                   Int(width) * Int(height) * ((info["channels"] as? Int) ?? 4) == byteCount {
+                    return Info(width: width, height: height,
+                                channels: info["channels"] as? Int, depths: info["depths"] as? Int, color: info["color"] as? Int)
+                }
+                return dictionary.values.lazy.compactMap(search).first
+            }
+            if let array = value as? [Any] {
+                return array.lazy.compactMap(search).first
+            }
+            return nil
+        }
+        
+        guard let object = try? JSONSerialization.jsonObject(with: Data(json.utf8)) else { return nil }
+        return search(object)
+    }
+    
+    func releaseImageOut(_ imageOut: UnsafeMutablePointer<UnsafeMutablePointer<UInt8>?>?) {
+        guard let imageOut = imageOut else { return }
+        
+        if let buffer = imageOut.pointee {
+            privid_free_char_buffer(UnsafeMutableRawPointer(buffer).assumingMemoryBound(to: CChar.self))
+        }
+        imageOut.deallocate()
+    }
+    
+    /// `channels` is 1 for grey, 3 for RGB and 4 for RGBA pixels.
+    func createImageFromRawData(rawData: UnsafeMutableRawPointer?, width: Double?, height: Double?, channels: Int = 4) -> UIImage? {
+        let bitsPerComponent = 8
+        let bytesPerPixel = channels
+        
+        let width = Int(width ?? 0)
+        let height = Int(height ?? 0)
+        
+        let colorSpace: CGColorSpace
+        let alphaInfo: CGImageAlphaInfo
+        switch channels {
+        case 1:
+            colorSpace = CGColorSpaceCreateDeviceGray()
+            alphaInfo = .none
+        case 3:
+            colorSpace = CGColorSpaceCreateDeviceRGB()
+            alphaInfo = .none
+        case 4:
+            colorSpace = CGColorSpaceCreateDeviceRGB()
+            alphaInfo = .premultipliedLast
+        default:
+            return nil
+        }
+        
+        guard let rawData = rawData, width > 0, height > 0 else {
+            return nil
+        }
+        
+        // The pixels are copied so the library buffer can be freed right after.
+        let data = Data(bytes: rawData, count: width * height * bytesPerPixel)
+        
+        guard let provider = CGDataProvider(data: data as CFData),
+              let cgImage = CGImage(width: width,
+                                    height: height,
+                                    bitsPerComponent: bitsPerComponent,
+                                    bitsPerPixel: bitsPerComponent * bytesPerPixel,
+                                    bytesPerRow: width * bytesPerPixel,
+                                    space: colorSpace,
+                                    bitmapInfo: CGBitmapInfo(rawValue: alphaInfo.rawValue),
+                                    provider: provider,
+                                    decode: nil,
+                                    shouldInterpolate: false,
+                                    intent: .defaultIntent) else {
+            return nil
+        }
+        
+        let image = UIImage(cgImage: cgImage)
+        return image
+    }
+    
+    func convertToNSString(pointer: UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>) -> String? {
+        guard let cStringPointer = pointer.pointee else { return nil }
+        return String(NSString(utf8String: cStringPointer) ?? "")
+    }
+    
+    func convertToNSStringForBarcode(pointer: UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>) -> String? {  // TEMP SOLUTION
+        guard let cStringPointer = pointer.pointee else { return nil }
+        var string = String(NSString(utf8String: cStringPointer) ?? "")
+        if let dotRange = string.range(of: "),") {
+            string.removeSubrange(dotRange.lowerBound..<string.endIndex)
+        }
+        
+        return string
+    }
+}
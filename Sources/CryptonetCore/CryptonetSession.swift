@@ -0,0 +1,63 @@
+import Foundation
+import privid_fhe
+
+/// An open library session and the operations running on it. Instances that share a session share
+/// this object, so the limit on concurrent operations holds for the session whichever instance
+/// the operations come from.
+package final class CryptonetSession {
+    package let pointer: UnsafeMutableRawPointer
+    let maxConcurrentCalls: Int
+    
+    private let slots: DispatchSemaphore
+    private let lock = NSLock()
+    private var isClosed = false
+    
+    init(pointer: UnsafeMutableRawPointer, maxConcurrentCalls: Int) {
+        self.pointer = pointer
+        self.maxConcurrentCalls = max(1, maxConcurrentCalls)
+        self.slots = DispatchSemaphore(value: self.maxConcurrentCalls)
+    }
+    
+    private var closed: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return isClosed
+    }
+    
+    /// Waits for a free slot. Returns `false` once the session is closed; otherwise the session stays
+    /// open until the matching `end()`.
+    func begin() -> Bool {
+        guard !closed else { return false }
+        
+        slots.wait()
+        if closed {
+            slots.signal()
+            return false
+        }
+        return true
+    }
+    
+    package func end() {
+        slots.signal()
+    }
+    
+    /// Refuses new operations, waits for the running ones and deinitializes the session.
+    func close() {
+        lock.lock()
+        guard !isClosed else {
+            lock.unlock()
+            return
+        }
+        isClosed = true
+        lock.unlock()
+        
+        for _ in 0..<maxConcurrentCalls {
+            slots.wait()
+        }
+        privid_deinitialize_session(pointer)
+        // Operations that were already waiting wake up, see the session is closed and give up.
+        for _ in 0..<maxConcurrentCalls {
+            slots.signal()
+        }
+    }
+}
@@ -0,0 +1,39 @@
+import Foundation
+
+/// Handle to an asynchronous call. Cancel it when its result is no longer needed, e.g. when the camera
+/// delivered a newer frame, so the stale work is dropped before it reaches the library.
+public final class CryptonetTask {
+    public let deadline: DispatchTime?
+    
+    private let lock = NSLock()
+    private var cancelled = false
+    
+    init(deadline: DispatchTime?) {
+        self.deadline = deadline
+    }
+    
+    public var isCancelled: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return cancelled
+    }
+    
+    public func cancel() {
+        lock.lock()
+        cancelled = true
+        lock.unlock()
+    }
+    
+    var isExpired: Bool {
+        guard let deadline = deadline else { return false }
+        return DispatchTime.now() >= deadline
+    }
+    
+    /// Error the work of the task stops with, `nil` while it should still run.
+    package var stopReason: CryptonetError? {
+        if isCancelled {
+            return .cancelled
+        }
+        return isExpired ? .deadlineExceeded : nil
+    }
+}
@@ -0,0 +1,64 @@
+import Foundation
+
+/// Picks the input tier of each operation from the running latency of its library calls. A tier is
+/// dropped as soon as the smoothed latency exceeds the budget, and raised again once the next tier is
+/// expected to fit in 80% of it. The expected cost of a tier scales with its pixel count. The first
+/// call of an operation loads and warms up its models, so its latency is ignored.
+package final class LatencyBudgetController {
+    private struct State {
+        var tier = InputTier.accurate
+        var isWarmedUp = false
+        var smoothedLatency: TimeInterval?
+    }
+    
+    private let lock = NSLock()
+    private var states: [CryptonetOperation: State] = [:]
+    
+    package func tier(for operation: CryptonetOperation, budget: TimeInterval?) -> InputTier {
+        guard budget != nil else { return .accurate }
+        
+        lock.lock()
+        defer { lock.unlock() }
+        return states[operation]?.tier ?? .accurate
+    }
+    
+    func currentTier(for operation: CryptonetOperation) -> InputTier {
+        lock.lock()
+        defer { lock.unlock() }
+        return states[operation]?.tier ?? .accurate
+    }
+    
+    package func record(_ operation: CryptonetOperation, tier: InputTier, budget: TimeInterval?, latency: TimeInterval) {
+        guard let budget = budget else { return }
+        
+        lock.lock()
+        defer { lock.unlock() }
+        
+        var state = states[operation] ?? State()
+        guard state.isWarmedUp else {
+            state.isWarmedUp = true
+            states[operation] = state
+            return
+        }
+        // A call started before the last tier change says nothing about the current tier.
+        guard tier == state.tier else { return }
+        
+        let smoothed = state.smoothedLatency.map { $0 * 0.8 + latency * 0.2 } ?? latency
+        state.smoothedLatency = smoothed
+        
+        if smoothed > budget, let lower = InputTier(rawValue: tier.rawValue - 1) {
+            state.tier = lower
+            state.smoothedLatency = smoothed * costRatio(from: tier, to: lower)
+        } else if let higher = InputTier(rawValue: tier.rawValue + 1),
+                  smoothed * costRatio(from: tier, to: higher) < budget * 0.8 {
+            state.tier = higher
+            state.smoothedLatency = smoothed * costRatio(from: tier, to: higher)
+        }
+        states[operation] = state
+    }
+    
+    private func costRatio(from tier: InputTier, to other: InputTier) -> Double {
+        let ratio = Double(other.maxPixelSize / tier.maxPixelSize)
+        return ratio * ratio
+    }
+}
@@ -0,0 +1,17 @@
+import Foundation
+import CoreGraphics
+
+package struct RgbaRawBitmap {
+    package let bytes: [UInt8]
+    package let width: Int32
+    package let height: Int32
+    /// Set when the bitmap is only a region of the frame.
+    package var frameRegion: FrameRegion? = nil
+}
+
+/// Where a bitmap cut out of a frame lies in it. Both are in the pixels of the whole frame scaled like
+/// the bitmap, i.e. the coordinates the library would have reported had it been sent the whole frame.
+package struct FrameRegion {
+    package let rect: CGRect
+    package let frameSize: CGSize
+}
@@ -1,8 +1,8 @@
 import UIKit
 
-struct ScanDocumentFaceModel: Codable {
+package struct ScanDocumentFaceModel: Codable {
     let callStatus: DocumentCallStatus?
-    let docFace: DocFace?
+    package let docFace: DocFace?
 
     enum CodingKeys: String, CodingKey {
         case callStatus = "call_status"
@@ -25,9 +25,9 @@ struct DocumentCallStatus: Codable {
     }
 }
 
-struct DocFace: Codable {
-    let documentData: DocumentData?
-    let croppedFaceImage: CroppedImage?
+package struct DocFace: Codable {
+    package let documentData: DocumentData?
+    package let croppedFaceImage: CroppedImage?
     let faceValidityMessage, uuid, guid, predictMessage: String?
     let opMessage: String?
     let predictStatus, enrollLevel: Int?
@@ -44,21 +44,20 @@ struct DocFace: Codable {
     }
 }
 
-struct CroppedImage: Codable {
-    let info: Info?
-    let data: String?
+package struct CroppedImage: Codable {
+    package let info: Info?
 }
 
-struct Info: Codable {
+package struct Info: Codable {
     let width, height: Double?
     let channels, depths, color: Int?
 }
 
-struct DocumentData: Codable {
+package struct DocumentData: Codable {
     let documentConfLevel: Double?
     let documentBoxCenter: DocumentBoxCenter?
     let croppedDocumentBox: CroppedDocumentBox?
-    let croppedDocumentImage: CroppedImage?
+    package let croppedDocumentImage: CroppedImage?
     let documentValidationStatus: Int?
     let statusMessage: String?
 
@@ -87,9 +86,9 @@ struct DocumentBoxCenter: Codable {
     let x, y: Int?
 }
 
-struct BarcodeDocumentModel: Codable {
+package struct BarcodeDocumentModel: Codable {
     let callStatus: DocumentCallStatus?
-    let barcode: Barcode?
+    package let barcode: Barcode?
 
     enum CodingKeys: String, CodingKey {
         case callStatus = "call_status"
@@ -98,9 +97,9 @@ struct BarcodeDocumentModel: Codable {
 }
 
 // MARK: - Barcode
-struct Barcode: Codable {
-    let documentData: DocumentData?
-    let documentBarcodeData: DocumentBarcodeData?
+package struct Barcode: Codable {
+    package let documentData: DocumentData?
+    package let documentBarcodeData: DocumentBarcodeData?
     let message: String?
 
     enum CodingKeys: String, CodingKey {
@@ -111,11 +110,11 @@ struct Barcode: Codable {
 }
 
 // MARK: - DocumentBarcodeData
-struct DocumentBarcodeData: Codable {
+package struct DocumentBarcodeData: Codable {
     let barcodeConfScore: Double?
     let barcodeBoxCenter: BarcodeBoxCenter?
     let nonCroppedBarcodeBox, croppedBarcodeBox: Box?
-    let croppedBarcodeImage: CroppedImage?
+    package let croppedBarcodeImage: CroppedImage?
     let barCodeDetectionStatus: Int?
     let barcodeData: BarcodeData?
     let statusMessage: String?
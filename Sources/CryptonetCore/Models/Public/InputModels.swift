@@ -3,11 +3,21 @@ import UIKit
 public struct ValidConfig: Codable {
     public let imageFormat: String
     public let skipAntispoof: Bool
+    /// Not sent to the library: normalised rectangle (top-left origin) the face is expected in. Only this
+    /// part of the frame is searched, and the result tells where it lies in the frame.
+    public private(set) var regionOfInterest: CGRect? = nil
+    /// Not sent to the library: target duration of a call, in seconds. When set, frames are sent at a
+    /// lower resolution while the measured latency exceeds it. See `CryptonetPackage.inputTier(for:)`.
+    public private(set) var latencyBudget: TimeInterval? = nil
     
     public init(imageFormat: String = "rgba",
-         skipAntispoof: Bool = true) {
+         skipAntispoof: Bool = true,
+         regionOfInterest: CGRect? = nil,
+         latencyBudget: TimeInterval? = nil) {
         self.imageFormat = imageFormat
         self.skipAntispoof = skipAntispoof
+        self.regionOfInterest = regionOfInterest
+        self.latencyBudget = latencyBudget
     }
     
     enum CodingKeys: String, CodingKey {
@@ -16,14 +26,34 @@ public struct ValidConfig: Codable {
     }
 }
 
+public struct AntispoofConfig: Codable {
+    public let imageFormat: String
+    /// Not sent to the library, see `ValidConfig.regionOfInterest`.
+    public private(set) var regionOfInterest: CGRect? = nil
+    
+    public init(imageFormat: String = "rgba",
+         regionOfInterest: CGRect? = nil) {
+        self.imageFormat = imageFormat
+        self.regionOfInterest = regionOfInterest
+    }
+    
+    enum CodingKeys: String, CodingKey {
+        case imageFormat = "input_image_format"
+    }
+}
+
 public struct EstimageAgeConfig: Codable {
     public let imageFormat: String
     public let skipAntispoof: Bool
+    /// Not sent to the library, see `ValidConfig.latencyBudget`.
+    public private(set) var latencyBudget: TimeInterval? = nil
     
     public init(imageFormat: String = "rgba",
-         skipAntispoof: Bool = true) {
+         skipAntispoof: Bool = true,
+         latencyBudget: TimeInterval? = nil) {
         self.imageFormat = imageFormat
         self.skipAntispoof = skipAntispoof
+        self.latencyBudget = latencyBudget
     }
     
     enum CodingKeys: String, CodingKey {
@@ -35,11 +65,15 @@ public struct EstimageAgeConfig: Codable {
 public struct PredictConfig: Codable {
     public let imageFormat: String
     public let skipAntispoof: Bool
+    /// Not sent to the library, see `ValidConfig.regionOfInterest`.
+    public private(set) var regionOfInterest: CGRect? = nil
     
     public init(imageFormat: String = "rgba",
-         skipAntispoof: Bool = true) {
+         skipAntispoof: Bool = true,
+         regionOfInterest: CGRect? = nil) {
         self.imageFormat = imageFormat
         self.skipAntispoof = skipAntispoof
+        self.regionOfInterest = regionOfInterest
     }
     
     enum CodingKeys: String, CodingKey {
@@ -76,6 +110,11 @@ public struct DocumentFrontScanConfig: Codable {
     public let thresholdDocY: Double
     public let documentAutoRotation: Bool
     public let blurThreshold: Double
+    /// Not sent to the library: crops that are not requested are never produced.
+    public private(set) var returnDocumentImage = true
+    public private(set) var returnFaceImage = true
+    /// Not sent to the library, see `ValidConfig.latencyBudget`.
+    public private(set) var latencyBudget: TimeInterval? = nil
     
     public init(imageFormat: String = "rgba",
          skipAntispoof: Bool = true,
@@ -83,7 +122,10 @@ public struct DocumentFrontScanConfig: Codable {
          thresholdDocX: Double = 0.02,
          thresholdDocY: Double = 0.02,
          documentAutoRotation: Bool = true,
-         blurThreshold: Double = 15.0) {
+         blurThreshold: Double = 15.0,
+         returnDocumentImage: Bool = true,
+         returnFaceImage: Bool = true,
+         latencyBudget: TimeInterval? = nil) {
         self.imageFormat = imageFormat
         self.skipAntispoof = skipAntispoof
         self.confidenceScore = confidenceScore
@@ -91,6 +133,9 @@ public struct DocumentFrontScanConfig: Codable {
         self.thresholdDocY = thresholdDocY
         self.documentAutoRotation = documentAutoRotation
         self.blurThreshold = blurThreshold
+        self.returnDocumentImage = returnDocumentImage
+        self.returnFaceImage = returnFaceImage
+        self.latencyBudget = latencyBudget
     }
     
     enum CodingKeys: String, CodingKey {
@@ -110,17 +155,24 @@ public struct DocumentBackScanConfig: Codable {
     public let documentScanBarcodeOnly: Bool
     public let thresholdDocX: Double
     public let thresholdDocY: Double
+    /// Not sent to the library: crops that are not requested are never produced.
+    public private(set) var returnDocumentImage = true
+    public private(set) var returnBarcodeImage = true
     
     public init(imageFormat: String = "rgba",
          skipAntispoof: Bool = true,
          documentScanBarcodeOnly: Bool = true,
          thresholdDocX: Double = 0.02,
-         thresholdDocY: Double = 0.02) {
+         thresholdDocY: Double = 0.02,
+         returnDocumentImage: Bool = true,
+         returnBarcodeImage: Bool = true) {
         self.imageFormat = imageFormat
         self.skipAntispoof = skipAntispoof
         self.documentScanBarcodeOnly = documentScanBarcodeOnly
         self.thresholdDocX = thresholdDocX
         self.thresholdDocY = thresholdDocY
+        self.returnDocumentImage = returnDocumentImage
+        self.returnBarcodeImage = returnBarcodeImage
     }
     
     enum CodingKeys: String, CodingKey {
@@ -171,3 +223,51 @@ public struct CompareFacesConfig: Codable {
         case faceMatchingThreshold = "face_thresholds_med"
     }
 }
+
+public struct FaceIsoConfig: Codable {
+    public let imageFormat: String
+    /// Not sent to the library, see `ValidConfig.regionOfInterest`.
+    public private(set) var regionOfInterest: CGRect? = nil
+    
+    public init(imageFormat: String = "rgba",
+         regionOfInterest: CGRect? = nil) {
+        self.imageFormat = imageFormat
+        self.regionOfInterest = regionOfInterest
+    }
+    
+    enum CodingKeys: String, CodingKey {
+        case imageFormat = "input_image_format"
+    }
+}
+
+public struct DocumentNoFaceScanConfig: Codable {
+    public let imageFormat: String
+    public let confidenceScore: Double
+    public let thresholdDocX: Double
+    public let thresholdDocY: Double
+    public let documentAutoRotation: Bool
+    /// Not sent to the library: a crop that is not requested is never produced.
+    public private(set) var returnDocumentImage = true
+    
+    public init(imageFormat: String = "rgba",
+         confidenceScore: Double = 0.3,
+         thresholdDocX: Double = 0.02,
+         thresholdDocY: Double = 0.02,
+         documentAutoRotation: Bool = true,
+         returnDocumentImage: Bool = true) {
+        self.imageFormat = imageFormat
+        self.confidenceScore = confidenceScore
+        self.thresholdDocX = thresholdDocX
+        self.thresholdDocY = thresholdDocY
+        self.documentAutoRotation = documentAutoRotation
+        self.returnDocumentImage = returnDocumentImage
+    }
+    
+    enum CodingKeys: String, CodingKey {
+        case imageFormat = "input_image_format"
+        case confidenceScore = "conf_score_thr_doc"
+        case thresholdDocX = "threshold_doc_x"
+        case thresholdDocY = "threshold_doc_y"
+        case documentAutoRotation = "document_auto_rotation"
+    }
+}
@@ -0,0 +1,117 @@
+import UIKit
+
+public struct ScanModel {
+    public let json: String
+    public let documentImage: UIImage?
+    public let mugshotImage: UIImage?
+    /// The library returned a crop that could not be decoded.
+    package let hasUndecodableImage: Bool
+    /// Status returned by the library call, when the caller keeps it.
+    package let libraryStatus: Int32?
+    
+    package init(json: String,
+                 documentImage: UIImage?,
+                 mugshotImage: UIImage?,
+                 hasUndecodableImage: Bool = false,
+                 libraryStatus: Int32? = nil) {
+        self.json = json
+        self.documentImage = documentImage
+        self.mugshotImage = mugshotImage
+        self.hasUndecodableImage = hasUndecodableImage
+        self.libraryStatus = libraryStatus
+    }
+}
+
+public struct FaceIsoModel {
+    public let json: String
+    /// Face cropped and aligned as per the Face ISO specification.
+    public let isoImage: UIImage?
+    /// The library returned a crop that could not be decoded.
+    package let hasUndecodableImage: Bool
+    /// Status returned by the library call, when the caller keeps it.
+    package let libraryStatus: Int32?
+    
+    package init(json: String, isoImage: UIImage?, hasUndecodableImage: Bool = false, libraryStatus: Int32? = nil) {
+        self.json = json
+        self.isoImage = isoImage
+        self.hasUndecodableImage = hasUndecodableImage
+        self.libraryStatus = libraryStatus
+    }
+}
+
+public enum CryptonetOperation: String, CaseIterable {
+    case validate
+    case antispoofCheck = "antispoof_check"
+    case estimateAge = "estimate_age"
+    case enroll
+    case predict
+    case userDelete = "user_delete"
+    case frontDocumentScan = "front_document_scan"
+    case backDocumentScan = "back_document_scan"
+    case compareDocumentAndFace = "compare_document_and_face"
+    case compareDocumentAndEmbeddings = "compare_document_and_embeddings"
+    case compareFaces = "compare_faces"
+    case faceIso = "face_iso"
+    case scanDocumentWithNoFace = "scan_document_with_no_face"
+}
+
+public struct OperationStats {
+    public internal(set) var count: Int = 0
+    public internal(set) var totalLatency: TimeInterval = 0
+    public internal(set) var maxLatency: TimeInterval = 0
+    public internal(set) var lastLatency: TimeInterval = 0
+    
+    public var averageLatency: TimeInterval {
+        count > 0 ? totalLatency / Double(count) : 0
+    }
+}
+
+public struct ResultCacheStats {
+    public let hits: Int
+    public let misses: Int
+    /// Number of results currently held.
+    public let count: Int
+    
+    public var hitRate: Double {
+        hits + misses > 0 ? Double(hits) / Double(hits + misses) : 0
+    }
+}
+
+/// Resolution the frames of an operation are sent to the library at.
+public enum InputTier: Int, CaseIterable, Comparable {
+    case fast
+    case balanced
+    case accurate
+    
+    /// Value of `input_tier` in the JSON results of calls made under a latency budget.
+    public var name: String {
+        switch self {
+        case .fast:
+            return "fast"
+        case .balanced:
+            return "balanced"
+        case .accurate:
+            return "accurate"
+        }
+    }
+    
+    /// Longest side, in pixels, of the frames sent to the library.
+    public var maxPixelSize: CGFloat {
+        switch self {
+        case .fast:
+            return 640
+        case .balanced:
+            return 800
+        case .accurate:
+            return 1000
+        }
+    }
+    
+    package var targetSize: CGSize {
+        CGSize(width: maxPixelSize, height: maxPixelSize)
+    }
+    
+    public static func < (lhs: InputTier, rhs: InputTier) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+}
@@ -0,0 +1,69 @@
+import Foundation
+
+package final class OperationStatsRecorder {
+    private let lock = NSLock()
+    private var stats: [CryptonetOperation: OperationStats] = [:]
+    private var pending = 0
+    private var recorder: CallRecorder?
+    
+    var pendingCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return pending
+    }
+    
+    package var callRecorder: CallRecorder? {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return recorder
+        }
+        set {
+            lock.lock()
+            recorder = newValue
+            lock.unlock()
+        }
+    }
+    
+    func stats(for operation: CryptonetOperation) -> OperationStats {
+        lock.lock()
+        defer { lock.unlock() }
+        return stats[operation] ?? OperationStats()
+    }
+    
+    func enqueue() {
+        lock.lock()
+        pending += 1
+        lock.unlock()
+    }
+    
+    func dequeue() {
+        lock.lock()
+        pending -= 1
+        lock.unlock()
+    }
+    
+    /// Times a library call and records its latency under `operation`. When a capture is running,
+    /// the call is also written to it together with the configuration and frames it was given.
+    package func measure(_ operation: CryptonetOperation,
+                 config: NSString,
+                 images: [RgbaRawBitmap] = [],
+                 _ call: () -> Int32) -> (status: Int32, latency: TimeInterval) {
+        let start = DispatchTime.now()
+        let status = call()
+        let latency = TimeInterval(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds) / 1_000_000_000
+        
+        lock.lock()
+        var current = stats[operation] ?? OperationStats()
+        current.count += 1
+        current.totalLatency += latency
+        current.maxLatency = max(current.maxLatency, latency)
+        current.lastLatency = latency
+        stats[operation] = current
+        let recorder = self.recorder
+        lock.unlock()
+        
+        recorder?.record(operation, config: config as String, images: images, latency: latency, status: status)
+        return (status, latency)
+    }
+}
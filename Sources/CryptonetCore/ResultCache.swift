@@ -0,0 +1,134 @@
+import UIKit
+
+/// Results of recent calls, keyed by operation, config and a 64-bit difference hash of the frame.
+/// A frame whose hash differs from a cached one in at most `tolerance` bits, sent with the same
+/// operation and config, gets the cached result. The least recently used entry is evicted once
+/// `capacity` is reached. The hash only sees the frame at 9x8 pixels, so two different people in the
+/// same pose and light can share one; callers must not cache results that vouch for identity or liveness.
+package final class ResultCache {
+    package struct Key {
+        let operation: CryptonetOperation
+        let config: String
+        let frameHash: UInt64
+    }
+    
+    private struct Entry {
+        let key: Key
+        let value: Any
+    }
+    
+    let capacity: Int
+    let tolerance: Int
+    
+    private let lock = NSLock()
+    // Most recently used last. Capacities are small, so a linear scan of the hashes beats any index.
+    private var entries: [Entry] = []
+    private var hits = 0
+    private var misses = 0
+    
+    init(capacity: Int, tolerance: Int) {
+        self.capacity = max(1, capacity)
+        self.tolerance = max(0, tolerance)
+    }
+    
+    var stats: ResultCacheStats {
+        lock.lock()
+        defer { lock.unlock() }
+        return ResultCacheStats(hits: hits, misses: misses, count: entries.count)
+    }
+    
+    package func key(for operation: CryptonetOperation,
+                     config: String,
+                     image: UIImage,
+                     regionOfInterest: CGRect? = nil) -> Key? {
+        ResultCache.frameHash(image, regionOfInterest: regionOfInterest).map {
+            Key(operation: operation, config: config, frameHash: $0)
+        }
+    }
+    
+    package func value<T>(for key: Key) -> T? {
+        lock.lock()
+        defer { lock.unlock() }
+        
+        guard let index = entries.lastIndex(where: { matches($0.key, key) }),
+              let value = entries[index].value as? T else {
+            misses += 1
+            return nil
+        }
+        
+        hits += 1
+        entries.append(entries.remove(at: index))
+        return value
+    }
+    
+    package func insert(_ value: Any, for key: Key) {
+        lock.lock()
+        defer { lock.unlock() }
+        
+        if let index = entries.lastIndex(where: { matches($0.key, key) }) {
+            entries.remove(at: index)
+        } else if entries.count >= capacity {
+            entries.removeFirst()
+        }
+        entries.append(Entry(key: key, value: value))
+    }
+    
+    private func matches(_ cached: Key, _ key: Key) -> Bool {
+        (cached.frameHash ^ key.frameHash).nonzeroBitCount <= tolerance
+            && cached.operation == key.operation
+            && cached.config == key.config
+    }
+    
+    /// dHash of the frame: UIKit draws it (or only `regionOfInterest` of it, normalised with a top-left
+    /// origin) at 9x8 pixels, and each bit tells whether a pixel is darker than its right neighbour. Small
+    /// changes in noise, exposure or compression flip few bits. Drawing that small is much cheaper than
+    /// converting the frame for the library, so a hit costs neither the conversion nor a session slot.
+    static func frameHash(_ image: UIImage, regionOfInterest: CGRect?) -> UInt64? {
+        let region = regionOfInterest ?? CGRect(x: 0, y: 0, width: 1, height: 1)
+        guard image.size.width > 0, image.size.height > 0, region.width > 0, region.height > 0 else { return nil }
+        
+        let hashWidth = 9
+        let hashHeight = 8
+        let bytesPerPixel = 4
+        var scaled = [UInt8](repeating: 0, count: hashWidth * hashHeight * bytesPerPixel)
+        
+        let drawn = scaled.withUnsafeMutableBytes { buffer -> Bool in
+            guard let context = CGContext(data: buffer.baseAddress,
+                                          width: hashWidth,
+                                          height: hashHeight,
+                                          bitsPerComponent: 8,
+                                          bytesPerRow: hashWidth * bytesPerPixel,
+                                          space: CGColorSpaceCreateDeviceRGB(),
+                                          bitmapInfo: CGImageAlphaInfo.noneSkipLast.rawValue) else {
+                return false
+            }
+            
+            // UIKit draws top-down and applies the orientation of the image.
+            context.translateBy(x: 0, y: CGFloat(hashHeight))
+            context.scaleBy(x: 1, y: -1)
+            context.interpolationQuality = .medium
+            
+            let width = CGFloat(hashWidth) / region.width
+            let height = CGFloat(hashHeight) / region.height
+            UIGraphicsPushContext(context)
+            image.draw(in: CGRect(x: -region.minX * width, y: -region.minY * height, width: width, height: height))
+            UIGraphicsPopContext()
+            return true
+        }
+        guard drawn else { return nil }
+        
+        // RGBA layout: BT.601 luma in fixed point.
+        let luma = stride(from: 0, to: scaled.count, by: bytesPerPixel).map {
+            (UInt32(scaled[$0]) * 77 + UInt32(scaled[$0 + 1]) * 150 + UInt32(scaled[$0 + 2]) * 29) >> 8
+        }
+        
+        var hash: UInt64 = 0
+        for row in 0..<hashHeight {
+            for column in 0..<hashWidth - 1 {
+                let index = row * hashWidth + column
+                hash = hash << 1 | (luma[index] < luma[index + 1] ? 1 : 0)
+            }
+        }
+        return hash
+    }
+}
@@ -0,0 +1,72 @@
+import Foundation
+
+/// Process-wide table of the sessions opened with `shared: true`, keyed by their settings,
+/// so instances with the same settings load the models only once.
+///
+/// Opening a session loads models and takes seconds, so it happens outside the lock: the first
+/// instance registers a pending entry for its settings and opens the session, later instances with
+/// the same settings wait for that entry only, and every other settings key is never blocked by it.
+final class SharedSessionRegistry {
+    static let shared = SharedSessionRegistry()
+    
+    private final class Entry {
+        var session: CryptonetSession?
+        var references = 1
+        /// Left once the session is open, or failed to open.
+        let opening = DispatchGroup()
+    }
+    
+    private let lock = NSLock()
+    private var entries: [String: Entry] = [:]
+    
+    func acquire(settings: String, open: () -> CryptonetSession?) -> CryptonetSession? {
+        lock.lock()
+        if let entry = entries[settings] {
+            entry.references += 1
+            lock.unlock()
+            
+            entry.opening.wait()
+            lock.lock()
+            defer { lock.unlock() }
+            return entry.session
+        }
+        
+        let entry = Entry()
+        entry.opening.enter()
+        entries[settings] = entry
+        lock.unlock()
+        
+        let session = open()
+        
+        lock.lock()
+        entry.session = session
+        // The instances that waited for it fail too; the next acquire tries to open it again.
+        if session == nil, entries[settings] === entry {
+            entries[settings] = nil
+        }
+        lock.unlock()
+        entry.opening.leave()
+        
+        return session
+    }
+    
+    /// Drops one reference and closes the session once the last one is gone.
+    func release(settings: String) {
+        lock.lock()
+        guard let entry = entries[settings], let session = entry.session else {
+            lock.unlock()
+            return
+        }
+        entry.references -= 1
+        let isLastReference = entry.references == 0
+        if isLastReference {
+            entries[settings] = nil
+        }
+        lock.unlock()
+        
+        // Closing waits for running operations, so it happens outside the lock.
+        if isLastReference {
+            session.close()
+        }
+    }
+}
@@ -0,0 +1,351 @@
+import UIKit
+import privid_fhe
+import CryptonetCore
+
+// Document scans and document-to-face comparison.
+public extension CryptonetPackage {
+    func frontDocumentScan(image: UIImage, config: DocumentFrontScanConfig) -> Result<ScanModel, Error> {
+        frontDocumentScan(image: image, config: config, task: nil)
+    }
+    
+    internal func frontDocumentScan(image: UIImage, config: DocumentFrontScanConfig, task: CryptonetTask?) -> Result<ScanModel, Error> {
+        let tier = latencyBudgetController.tier(for: .frontDocumentScan, budget: config.latencyBudget)
+        
+        guard let bitmap = convertImageToRgbaRawBitmap(image: image, targetSize: tier.targetSize) else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            let byteImageArray = bitmap.bytes
+            
+            let imageWidth = bitmap.width
+            let imageHeight = bitmap.height
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let croppedDocOut = allocateImageOut(isRequested: config.returnDocumentImage)
+            let croppedDocLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let croppedFaceOut = allocateImageOut(isRequested: config.returnFaceImage)
+            let croppedFaceLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            
+            let status = callLibrary(.frontDocumentScan, config: userConfig, images: [bitmap], task: task, tier: tier, budget: config.latencyBudget) { session in
+                privid_doc_scan_face(session,
+                                     userConfigPointer,
+                                     Int32(userConfig.length),
+                                     byteImageArray,
+                                     imageWidth,
+                                     imageHeight,
+                                     croppedDocOut,
+                                     croppedDocLengthOut,
+                                     croppedFaceOut,
+                                     croppedFaceLengthOut,
+                                     bufferOut,
+                                     lengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            let model = outputString.flatMap { try? ScanDocumentFaceModel(json: $0) }
+            
+            let documentImage = takeImage(from: croppedDocOut,
+                                          info: model?.docFace?.documentData?.croppedDocumentImage?.info)
+            let faceImage = takeImage(from: croppedFaceOut,
+                                      info: model?.docFace?.croppedFaceImage?.info)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            
+            croppedDocLengthOut.deallocate()
+            croppedFaceLengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            return .success(ScanModel(json: resultJSON(outputString, inputTier: tier, budget: config.latencyBudget),
+                                      documentImage: documentImage,
+                                      mugshotImage: faceImage))
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+    
+    func backDocumentScan(image: UIImage, config: DocumentBackScanConfig) -> Result<ScanModel, Error> {
+        backDocumentScan(image: image, config: config, task: nil)
+    }
+    
+    internal func backDocumentScan(image: UIImage, config: DocumentBackScanConfig, task: CryptonetTask?) -> Result<ScanModel, Error> {
+        guard let bitmap = convertImageToRgbaRawBitmap(image: image) else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            
+            let byteImageArray = bitmap.bytes
+            
+            let imageWidth = bitmap.width
+            let imageHeight = bitmap.height
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let croppedDocOut = allocateImageOut(isRequested: config.returnDocumentImage)
+            let croppedDocLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let croppedBarcodeOut = allocateImageOut(isRequested: config.returnBarcodeImage)
+            let croppedBarcodeLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            
+            let status = callLibrary(.backDocumentScan, config: userConfig, images: [bitmap], task: task) { session in
+                privid_doc_scan_barcode(session,
+                                        userConfigPointer,
+                                        Int32(userConfig.length),
+                                        byteImageArray,
+                                        imageWidth,
+                                        imageHeight,
+                                        croppedDocOut,
+                                        croppedDocLengthOut,
+                                        croppedBarcodeOut,
+                                        croppedBarcodeLengthOut,
+                                        bufferOut,
+                                        lengthOut)
+            }
+            
+            let outputString = convertToNSStringForBarcode(pointer: bufferOut)
+            let model = outputString.flatMap { try? BarcodeDocumentModel(json: $0) }
+            
+            let documentImage = takeImage(from: croppedDocOut,
+                                          info: model?.barcode?.documentData?.croppedDocumentImage?.info)
+            let barcodeImage = takeImage(from: croppedBarcodeOut,
+                                         info: model?.barcode?.documentBarcodeData?.croppedBarcodeImage?.info)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            
+            croppedDocLengthOut.deallocate()
+            croppedBarcodeLengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            return .success(ScanModel(json: outputString, documentImage: documentImage, mugshotImage: barcodeImage))
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+    
+    func compareDocumentAndFace(documentImage: UIImage, selfieImage: UIImage, config: DocumentAndFaceConfig) -> Result<String, Error> {
+        compareDocumentAndFace(documentImage: documentImage, selfieImage: selfieImage, config: config, task: nil)
+    }
+    
+    internal func compareDocumentAndFace(documentImage: UIImage, selfieImage: UIImage, config: DocumentAndFaceConfig, task: CryptonetTask?) -> Result<String, Error> {
+            guard let documentBitmap = convertImageToRgbaRawBitmap(image: documentImage),
+                  let selfieBitmap = convertImageToRgbaRawBitmap(image: selfieImage)
+            else {
+                return .failure(CryptonetError.failed)
+            }
+            
+            do {
+                let configData = try JSONEncoder().encode(config)
+                let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+                
+                let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+                
+                let byteDocumentImageArray = documentBitmap.bytes
+                
+                let documentImageWidth = documentBitmap.width
+                let documentImageHeight = documentBitmap.height
+                
+                let byteSelfieImageArray = selfieBitmap.bytes
+                
+                let selfieImageWidth = selfieBitmap.width
+                let selfieImageHeight = selfieBitmap.height
+                
+                // Only the JSON is returned, so the library is not asked for the crops.
+                let croppedDocumentOut = allocateImageOut(isRequested: false)
+                let croppedDocumentLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+                
+                let croppedFaceOut = allocateImageOut(isRequested: false)
+                let croppedFaceLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+                
+                let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+                bufferOut.initialize(to: nil)
+                let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+                
+                let status = callLibrary(.compareDocumentAndFace, config: userConfig, images: [documentBitmap, selfieBitmap], task: task) { session in
+                    privid_compare_mugshot_and_face(session,
+                                                    userConfigPointer,
+                                                    Int32(userConfig.length),
+                                                    byteDocumentImageArray,
+                                                    documentImageWidth,
+                                                    documentImageHeight,
+                                                    byteSelfieImageArray,
+                                                    selfieImageWidth,
+                                                    selfieImageHeight,
+                                                    croppedDocumentOut,
+                                                    croppedDocumentLengthOut,
+                                                    croppedFaceOut,
+                                                    croppedFaceLengthOut,
+                                                    bufferOut,
+                                                    lengthOut)
+                }
+                
+                guard let outputString = convertToNSString(pointer: bufferOut) else {
+                    privid_free_char_buffer(bufferOut.pointee)
+                    releaseImageOut(croppedDocumentOut)
+                    croppedDocumentLengthOut.deallocate()
+                    releaseImageOut(croppedFaceOut)
+                    croppedFaceLengthOut.deallocate()
+                    bufferOut.deallocate()
+                    lengthOut.deallocate()
+                    if case .failure(let error) = status { return .failure(error) }
+                    return .failure(CryptonetError.failed)
+                }
+                
+                privid_free_char_buffer(bufferOut.pointee)
+                releaseImageOut(croppedDocumentOut)
+                croppedDocumentLengthOut.deallocate()
+                releaseImageOut(croppedFaceOut)
+                croppedFaceLengthOut.deallocate()
+                bufferOut.deallocate()
+                lengthOut.deallocate()
+                
+                return .success(String(outputString))
+            } catch {
+                return .failure(CryptonetError.failed)
+            }
+        }
+    
+    /// Compares the face on a document with a face enrolled earlier, using the encrypted embeddings
+    /// that enroll returned instead of a selfie. Only the document goes through detection and
+    /// embedding, so a stored face can be compared again and again at the cost of one image.
+    func compareDocumentAndEmbeddings(documentImage: UIImage, encryptedEmbeddings: String, config: DocumentAndFaceConfig) -> Result<String, Error> {
+        compareDocumentAndEmbeddings(documentImage: documentImage, encryptedEmbeddings: encryptedEmbeddings, config: config, task: nil)
+    }
+    
+    internal func compareDocumentAndEmbeddings(documentImage: UIImage, encryptedEmbeddings: String, config: DocumentAndFaceConfig, task: CryptonetTask?) -> Result<String, Error> {
+        guard let documentBitmap = convertImageToRgbaRawBitmap(image: documentImage)
+        else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let embeddings = NSString(string: encryptedEmbeddings)
+            let embeddingsPointer = UnsafeMutablePointer<CChar>(mutating: embeddings.utf8String)
+            
+            // Only the JSON is returned, so the library is not asked for the crop.
+            let croppedDocumentOut = allocateImageOut(isRequested: false)
+            let croppedDocumentLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let status = callLibrary(.compareDocumentAndEmbeddings, config: userConfig, images: [documentBitmap], task: task) { session in
+                privid_compare_mugshot_and_embeddings(session,
+                                                      userConfigPointer,
+                                                      Int32(userConfig.length),
+                                                      documentBitmap.bytes,
+                                                      documentBitmap.width,
+                                                      documentBitmap.height,
+                                                      croppedDocumentOut,
+                                                      croppedDocumentLengthOut,
+                                                      embeddingsPointer,
+                                                      Int32(embeddings.lengthOfBytes(using: String.Encoding.utf8.rawValue)),
+                                                      bufferOut,
+                                                      lengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            releaseImageOut(croppedDocumentOut)
+            croppedDocumentLengthOut.deallocate()
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.failed) }
+            return .success(outputString)
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+    
+    /// Finds and crops a document that has no face on it.
+    func scanDocumentWithNoFace(image: UIImage, config: DocumentNoFaceScanConfig) -> Result<ScanModel, Error> {
+        scanDocumentWithNoFace(image: image, config: config, task: nil)
+    }
+    
+    internal func scanDocumentWithNoFace(image: UIImage, config: DocumentNoFaceScanConfig, task: CryptonetTask?) -> Result<ScanModel, Error> {
+        guard let bitmap = convertImageToRgbaRawBitmap(image: image) else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let croppedDocOut = allocateImageOut(isRequested: config.returnDocumentImage)
+            let croppedDocLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            croppedDocLengthOut.initialize(to: 0)
+            
+            let status = callLibrary(.scanDocumentWithNoFace, config: userConfig, images: [bitmap], task: task) { session in
+                privid_scan_document_with_no_face(session,
+                                                  userConfigPointer,
+                                                  Int32(userConfig.length),
+                                                  bitmap.bytes,
+                                                  bitmap.width,
+                                                  bitmap.height,
+                                                  croppedDocOut,
+                                                  croppedDocLengthOut,
+                                                  bufferOut,
+                                                  lengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            let documentImageLength = croppedDocLengthOut.pointee
+            let documentImage = takeImage(from: croppedDocOut, length: documentImageLength, json: outputString)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            croppedDocLengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            return .success(ScanModel(json: outputString,
+                                      documentImage: documentImage,
+                                      mugshotImage: nil,
+                                      hasUndecodableImage: documentImageLength > 0 && documentImage == nil,
+                                      libraryStatus: try? status.get()))
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+}
@@ -0,0 +1,41 @@
+import UIKit
+import CryptonetCore
+
+/// Asynchronous variants of the document calls, run on the executor of the instance.
+public extension CryptonetPackage {
+    @discardableResult
+    func frontDocumentScan(image: UIImage, config: DocumentFrontScanConfig, deadline: DispatchTime? = nil,
+                           completion: @escaping (Result<ScanModel, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.frontDocumentScan(image: image, config: config, task: $0) }, completion: completion)
+    }
+    
+    @discardableResult
+    func backDocumentScan(image: UIImage, config: DocumentBackScanConfig, deadline: DispatchTime? = nil,
+                          completion: @escaping (Result<ScanModel, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.backDocumentScan(image: image, config: config, task: $0) }, completion: completion)
+    }
+    
+    @discardableResult
+    func compareDocumentAndFace(documentImage: UIImage, selfieImage: UIImage, config: DocumentAndFaceConfig,
+                                deadline: DispatchTime? = nil,
+                                completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline,
+                { self.compareDocumentAndFace(documentImage: documentImage, selfieImage: selfieImage, config: config, task: $0) },
+                completion: completion)
+    }
+    
+    @discardableResult
+    func compareDocumentAndEmbeddings(documentImage: UIImage, encryptedEmbeddings: String, config: DocumentAndFaceConfig,
+                                      deadline: DispatchTime? = nil,
+                                      completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline,
+                { self.compareDocumentAndEmbeddings(documentImage: documentImage, encryptedEmbeddings: encryptedEmbeddings, config: config, task: $0) },
+                completion: completion)
+    }
+    
+    @discardableResult
+    func scanDocumentWithNoFace(image: UIImage, config: DocumentNoFaceScanConfig, deadline: DispatchTime? = nil,
+                                completion: @escaping (Result<ScanModel, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.scanDocumentWithNoFace(image: image, config: config, task: $0) }, completion: completion)
+    }
+}
@@ -0,0 +1,406 @@
+import UIKit
+import privid_fhe
+import CryptonetCore
+
+// Face validation, anti-spoof, enrollment, prediction and face comparison.
+public extension CryptonetPackage {
+    func validate(image: UIImage, config: ValidConfig) -> Result<String, Error> {
+        validate(image: image, config: config, task: nil)
+    }
+    
+    internal func validate(image: UIImage, config: ValidConfig, task: CryptonetTask?) -> Result<String, Error> {
+        let tier = latencyBudgetController.tier(for: .validate, budget: config.latencyBudget)
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            
+            // Looked up before the frame is converted. A liveness verdict is never reused for another
+            // frame: the hash cannot tell a live face from a picture of it.
+            let cache = config.skipAntispoof ? resultCache : nil
+            // The region is not part of the library config but changes the result.
+            let cacheConfig = "\(userConfig) \(String(describing: config.regionOfInterest))"
+            let cacheKey = cache?.key(for: .validate,
+                                      config: cacheConfig,
+                                      image: image,
+                                      regionOfInterest: config.regionOfInterest)
+            if let cacheKey = cacheKey, let cached: String = cache?.value(for: cacheKey) {
+                return .success(cached)
+            }
+            
+            guard let bitmap = convertImageToRgbaRawBitmap(image: image,
+                                                           targetSize: tier.targetSize,
+                                                           regionOfInterest: config.regionOfInterest) else {
+                return .failure(CryptonetError.failed)
+            }
+            
+            let imageWidth = bitmap.width
+            let imageHeight = bitmap.height
+            let byteImageArray = bitmap.bytes
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let status = callLibrary(.validate, config: userConfig, images: [bitmap], task: task, tier: tier, budget: config.latencyBudget) { session in
+                privid_validate(session,
+                                byteImageArray,
+                                imageWidth,
+                                imageHeight,
+                                userConfigPointer,
+                                Int32(userConfig.length),
+                                bufferOut,
+                                lengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            let result = resultJSON(outputString, inputTier: tier, budget: config.latencyBudget, region: bitmap.frameRegion)
+            if let cacheKey = cacheKey {
+                cache?.insert(result, for: cacheKey)
+            }
+            return .success(result)
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+    
+    func antispoofCheck(image: UIImage, config: AntispoofConfig) -> Result<String, Error> {
+        antispoofCheck(image: image, config: config, task: nil)
+    }
+    
+    internal func antispoofCheck(image: UIImage, config: AntispoofConfig, task: CryptonetTask?) -> Result<String, Error> {
+        guard let bitmap = convertImageToRgbaRawBitmap(image: image, regionOfInterest: config.regionOfInterest) else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            
+            let imageWidth = bitmap.width
+            let imageHeight = bitmap.height
+            let byteImageArray = bitmap.bytes
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let status = callLibrary(.antispoofCheck, config: userConfig, images: [bitmap], task: task) { session in
+                privid_anti_spoofing(session,
+                                     byteImageArray,
+                                     imageWidth,
+                                     imageHeight,
+                                     userConfigPointer,
+                                     Int32(userConfig.length),
+                                     bufferOut,
+                                     lengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            return .success(resultJSON(outputString, region: bitmap.frameRegion))
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+
+    func enroll(image: UIImage, config: EnrollConfig) -> Result<String, Error> {
+        enroll(images: [image], config: config)
+    }
+    
+    /// Enrolls from several frames of the same user in one library call. The frames are checked,
+    /// embedded and encrypted together and the backend is asked once, instead of the same work and
+    /// round trip for every frame. Every frame is scaled to the size of the first one.
+    func enroll(images: [UIImage], config: EnrollConfig) -> Result<String, Error> {
+        enroll(images: images, config: config, task: nil)
+    }
+    
+    internal func enroll(images: [UIImage], config: EnrollConfig, task: CryptonetTask?) -> Result<String, Error> {
+        guard let bitmap = convertImagesToRgbaRawBitmap(images: images) else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            let byteImageArray = bitmap.bytes
+            let imageCount = Int32(images.count)
+            let imageWidth = bitmap.width
+            let imageHeight = bitmap.height
+            let imageSize = Int32(byteImageArray.count) / imageCount
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            // The best input is never returned to the caller, so the library is not asked for it.
+            let bestInputOut = allocateImageOut(isRequested: false)
+            let bestInputLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            bestInputLengthOut.initialize(to: 0)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let status = callLibrary(.enroll, config: userConfig, images: [bitmap], task: task) { session in
+                privid_enroll_onefa(session,
+                                    userConfigPointer,
+                                    Int32(userConfig.length),
+                                    byteImageArray,
+                                    imageCount,
+                                    imageSize,
+                                    imageWidth,
+                                    imageHeight,
+                                    bestInputOut,
+                                    bestInputLengthOut,
+                                    bufferOut,
+                                    lengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            releaseImageOut(bestInputOut)
+            bestInputLengthOut.deallocate()
+            
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            return .success(outputString)
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+    
+    func predict(image: UIImage, config: PredictConfig) -> Result<String, Error> {
+        predict(images: [image], config: config)
+    }
+    
+    /// Predicts over several frames of the same user in one library call, so the backend is asked once
+    /// instead of once per frame. Every frame is scaled to the size of the first one.
+    func predict(images: [UIImage], config: PredictConfig) -> Result<String, Error> {
+        predict(images: images, config: config, task: nil)
+    }
+    
+    internal func predict(images: [UIImage], config: PredictConfig, task: CryptonetTask?) -> Result<String, Error> {
+        guard let bitmap = convertImagesToRgbaRawBitmap(images: images, regionOfInterest: config.regionOfInterest) else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            let byteImageArray = bitmap.bytes
+            let imageCount = Int32(images.count)
+            let imageWidth = bitmap.width
+            let imageHeight = bitmap.height
+            let imageSize = Int32(byteImageArray.count) / imageCount
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let status = callLibrary(.predict, config: userConfig, images: [bitmap], task: task) { session in
+                privid_face_predict_onefa(session,
+                                          userConfigPointer,
+                                          Int32(userConfig.length),
+                                          byteImageArray,
+                                          imageCount,
+                                          imageSize,
+                                          imageWidth,
+                                          imageHeight,
+                                          bufferOut,
+                                          lengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            return .success(resultJSON(outputString, region: bitmap.frameRegion))
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+    
+    func userDelete(puid: NSString) -> String? {
+        let puidPointer = UnsafeMutablePointer<CChar>(mutating: puid.utf8String)
+        
+        let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+        bufferOut.initialize(to: nil)
+        let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+        
+        let userConfig = NSString(string: "{}")
+        let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+        
+        let _ = callLibrary(.userDelete, config: userConfig, task: nil) { session in
+            privid_user_delete(session,
+                               userConfigPointer,
+                               Int32(userConfig.length),
+                               puidPointer,
+                               Int32(puid.length),
+                               bufferOut,
+                               lengthOut)
+        }
+        
+        let outputString = convertToNSString(pointer: bufferOut)
+        
+        privid_free_char_buffer(bufferOut.pointee)
+        
+        bufferOut.deallocate()
+        lengthOut.deallocate()
+        
+        return outputString
+    }
+
+    func compareFaces(faceOne: UIImage, faceTwo: UIImage, config: CompareFacesConfig) -> Result<String, Error> {
+        compareFaces(faceOne: faceOne, faceTwo: faceTwo, config: config, task: nil)
+    }
+    
+    internal func compareFaces(faceOne: UIImage, faceTwo: UIImage, config: CompareFacesConfig, task: CryptonetTask?) -> Result<String, Error> {
+        guard let mugshotBitmap = convertImageToRgbaRawBitmap(image: faceOne),
+              let selfieBitmap = convertImageToRgbaRawBitmap(image: faceTwo)
+        else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let byteMugshotImageArray = mugshotBitmap.bytes
+            
+            let mugshotImageWidth = mugshotBitmap.width
+            let mugshotImageHeight = mugshotBitmap.height
+            
+            let byteSelfieImageArray = selfieBitmap.bytes
+            
+            let selfieImageWidth = selfieBitmap.width
+            let selfieImageHeight = selfieBitmap.height
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let status = callLibrary(.compareFaces, config: userConfig, images: [mugshotBitmap, selfieBitmap], task: task) { session in
+                privid_face_compare_files(session,
+                                          0.0,
+                                          userConfigPointer,
+                                          Int32(userConfig.length),
+                                          byteMugshotImageArray,
+                                          Int32(byteMugshotImageArray.count),
+                                          mugshotImageWidth,
+                                          mugshotImageHeight,
+                                          byteSelfieImageArray,
+                                          Int32(byteSelfieImageArray.count),
+                                          selfieImageWidth,
+                                          selfieImageHeight,
+                                          bufferOut,
+                                          lengthOut)
+            }
+            
+            guard let outputString = convertToNSString(pointer: bufferOut) else {
+                privid_free_char_buffer(bufferOut.pointee)
+                bufferOut.deallocate()
+                lengthOut.deallocate()
+                if case .failure(let error) = status { return .failure(error) }
+                return .failure(CryptonetError.failed)
+            }
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            
+            return .success(String(outputString))
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+    
+    /// Crops and aligns the face as per the Face ISO specification, e.g. for ID photos.
+    func faceIso(image: UIImage, config: FaceIsoConfig) -> Result<FaceIsoModel, Error> {
+        faceIso(image: image, config: config, task: nil)
+    }
+    
+    internal func faceIso(image: UIImage, config: FaceIsoConfig, task: CryptonetTask?) -> Result<FaceIsoModel, Error> {
+        guard let bitmap = convertImageToRgbaRawBitmap(image: image, regionOfInterest: config.regionOfInterest) else {
+            return .failure(CryptonetError.failed)
+        }
+        
+        do {
+            let configData = try JSONEncoder().encode(config)
+            let userConfig = NSString(string: String(data: configData, encoding: .utf8)!)
+            
+            let userConfigPointer = UnsafeMutablePointer<CChar>(mutating: userConfig.utf8String)
+            
+            let bufferOut = UnsafeMutablePointer<UnsafeMutablePointer<CChar>?>.allocate(capacity: 1)
+            bufferOut.initialize(to: nil)
+            let lengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            
+            let isoImageOut = allocateImageOut(isRequested: true)
+            let isoImageLengthOut = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+            isoImageLengthOut.initialize(to: 0)
+            
+            let status = callLibrary(.faceIso, config: userConfig, images: [bitmap], task: task) { session in
+                privid_face_iso(session,
+                                bitmap.bytes,
+                                bitmap.width,
+                                bitmap.height,
+                                userConfigPointer,
+                                Int32(userConfig.length),
+                                bufferOut,
+                                lengthOut,
+                                isoImageOut,
+                                isoImageLengthOut)
+            }
+            
+            let outputString = convertToNSString(pointer: bufferOut)
+            let isoImageLength = isoImageLengthOut.pointee
+            let isoImage = takeImage(from: isoImageOut, length: isoImageLength, json: outputString)
+            
+            privid_free_char_buffer(bufferOut.pointee)
+            
+            bufferOut.deallocate()
+            lengthOut.deallocate()
+            isoImageLengthOut.deallocate()
+            
+            if case .failure(let error) = status { return .failure(error) }
+            guard let outputString = outputString else { return .failure(CryptonetError.noJSON) }
+            return .success(FaceIsoModel(json: resultJSON(outputString, region: bitmap.frameRegion),
+                                         isoImage: isoImage,
+                                         hasUndecodableImage: isoImageLength > 0 && isoImage == nil,
+                                         libraryStatus: try? status.get()))
+        } catch {
+            return .failure(CryptonetError.failed)
+        }
+    }
+}
@@ -0,0 +1,56 @@
+import UIKit
+import CryptonetCore
+
+/// Asynchronous variants of the face calls, run on the executor of the instance.
+public extension CryptonetPackage {
+    @discardableResult
+    func validate(image: UIImage, config: ValidConfig, deadline: DispatchTime? = nil,
+                  completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.validate(image: image, config: config, task: $0) }, completion: completion)
+    }
+    
+    @discardableResult
+    func antispoofCheck(image: UIImage, config: AntispoofConfig, deadline: DispatchTime? = nil,
+                        completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.antispoofCheck(image: image, config: config, task: $0) }, completion: completion)
+    }
+    
+    @discardableResult
+    func enroll(image: UIImage, config: EnrollConfig, deadline: DispatchTime? = nil,
+                completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.enroll(images: [image], config: config, task: $0) }, completion: completion)
+    }
+    
+    @discardableResult
+    func enroll(images: [UIImage], config: EnrollConfig, deadline: DispatchTime? = nil,
+                completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.enroll(images: images, config: config, task: $0) }, completion: completion)
+    }
+    
+    @discardableResult
+    func predict(image: UIImage, config: PredictConfig, deadline: DispatchTime? = nil,
+                 completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.predict(images: [image], config: config, task: $0) }, completion: completion)
+    }
+    
+    @discardableResult
+    func predict(images: [UIImage], config: PredictConfig, deadline: DispatchTime? = nil,
+                 completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.predict(images: images, config: config, task: $0) }, completion: completion)
+    }
+    
+    @discardableResult
+    func compareFaces(faceOne: UIImage, faceTwo: UIImage, config: CompareFacesConfig,
+                      deadline: DispatchTime? = nil,
+                      completion: @escaping (Result<String, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline,
+                { self.compareFaces(faceOne: faceOne, faceTwo: faceTwo, config: config, task: $0) },
+                completion: completion)
+    }
+    
+    @discardableResult
+    func faceIso(image: UIImage, config: FaceIsoConfig, deadline: DispatchTime? = nil,
+                 completion: @escaping (Result<FaceIsoModel, Error>) -> Void) -> CryptonetTask {
+        perform(deadline: deadline, { self.faceIso(image: image, config: config, task: $0) }, completion: completion)
+    }
+}
@@ -0,0 +1,67 @@
+import Foundation
+
+public enum LivenessVerdict {
+    case live
+    case spoof
+    /// `maxFrames` were consumed without the evidence reaching either threshold.
+    case inconclusive
+}
+
+/// Accumulates per-frame anti-spoof statuses and decides as soon as the evidence allows it,
+/// so a liveness check stops requesting frames once it is settled.
+///
+/// Each `0` (real) status moves the score up by one. Each `1` (spoof) or `-2` (mobile phone detected)
+/// status moves it down by one, since a phone in the frame is how screen replays are presented.
+/// Frames without a usable face (other negative statuses) are counted but carry no evidence.
+/// Not thread-safe: feed it from one thread, in frame order.
+public final class LivenessAccumulator {
+    public let liveThreshold: Int
+    public let spoofThreshold: Int
+    public let maxFrames: Int
+    
+    public private(set) var score = 0
+    public private(set) var frameCount = 0
+    public private(set) var verdict: LivenessVerdict?
+    
+    /// - Parameters:
+    ///   - liveThreshold: score at which the subject is considered live.
+    ///   - spoofThreshold: negative score magnitude at which the subject is considered a spoof.
+    ///   - maxFrames: frames after which the check gives up as inconclusive.
+    public init(liveThreshold: Int = 3, spoofThreshold: Int = 2, maxFrames: Int = 10) {
+        self.liveThreshold = liveThreshold
+        self.spoofThreshold = spoofThreshold
+        self.maxFrames = maxFrames
+    }
+    
+    /// Adds the anti-spoof status of the next frame.
+    /// - Returns: the verdict once it is reached, `nil` while more frames are needed.
+    @discardableResult
+    public func add(status: Int) -> LivenessVerdict? {
+        guard verdict == nil else { return verdict }
+        
+        frameCount += 1
+        switch status {
+        case 0:
+            score += 1
+        case 1, -2:
+            score -= 1
+        default:
+            break
+        }
+        
+        if score >= liveThreshold {
+            verdict = .live
+        } else if score <= -spoofThreshold {
+            verdict = .spoof
+        } else if frameCount >= maxFrames {
+            verdict = .inconclusive
+        }
+        return verdict
+    }
+    
+    public func reset() {
+        score = 0
+        frameCount = 0
+        verdict = nil
+    }
+}
@@ -0,0 +1,255 @@
+import UIKit
+
+/// Operation a `BatchPipeline` runs on every input image.
+public enum BatchOperation {
+    /// Writes the Face ISO crop of each image.
+    case faceIso(FaceIsoConfig)
+    /// Writes the document crop of each image of a document without a face.
+    case documentCrop(DocumentNoFaceScanConfig)
+}
+
+public struct BatchInput {
+    public let url: URL
+    /// Path of the outputs relative to the output directory, without extension.
+    public let name: String
+    
+    public init(url: URL, name: String) {
+        self.url = url
+        self.name = name
+    }
+    
+    private static let imageExtensions: Set<String> = ["jpg", "jpeg", "png", "heic", "heif", "tif", "tiff", "bmp"]
+    
+    /// Image files anywhere under `directory`, listed as the pipeline consumes them. Outputs mirror
+    /// the subdirectories.
+    public static func files(in directory: URL) -> AnySequence<BatchInput> {
+        let rootPath = directory.standardizedFileURL.path
+        let enumerator = FileManager.default.enumerator(at: directory,
+                                                        includingPropertiesForKeys: [.isRegularFileKey],
+                                                        options: [.skipsHiddenFiles])
+        
+        return AnySequence(AnyIterator {
+            while let url = enumerator?.nextObject() as? URL {
+                guard imageExtensions.contains(url.pathExtension.lowercased()) else { continue }
+                
+                return BatchInput(url: url, name: name(of: url, relativeTo: rootPath))
+            }
+            return nil
+        })
+    }
+    
+    /// One image path per line of `manifest`, read in chunks so its size does not matter. Relative paths
+    /// are resolved against the manifest's directory. Like `files(in:)`, outputs mirror the path of the
+    /// images relative to that directory, so images with the same file name get outputs of their own.
+    public static func manifest(at manifest: URL) -> AnySequence<BatchInput> {
+        let baseDirectory = manifest.deletingLastPathComponent()
+        let rootPath = baseDirectory.standardizedFileURL.path
+        
+        return AnySequence { () -> AnyIterator<BatchInput> in
+            let fileHandle = try? FileHandle(forReadingFrom: manifest)
+            var buffer = Data()
+            var isAtEnd = fileHandle == nil
+            
+            return AnyIterator {
+                while true {
+                    // The last line may have no newline after it.
+                    let lineEnd = buffer.firstIndex(of: UInt8(ascii: "\n")) ?? (isAtEnd && !buffer.isEmpty ? buffer.endIndex : nil)
+                    if let lineEnd = lineEnd {
+                        let line = String(decoding: buffer[buffer.startIndex..<lineEnd], as: UTF8.self)
+                            .trimmingCharacters(in: .whitespacesAndNewlines)
+                        buffer = lineEnd < buffer.endIndex ? buffer[buffer.index(after: lineEnd)...] : Data()
+                        guard !line.isEmpty else { continue }
+                        
+                        let url = line.hasPrefix("/") ? URL(fileURLWithPath: line) : baseDirectory.appendingPathComponent(line)
+                        return BatchInput(url: url, name: name(of: url, relativeTo: rootPath))
+                    }
+                    
+                    guard !isAtEnd, let fileHandle = fileHandle else { return nil }
+                    let chunk = fileHandle.readData(ofLength: 64 * 1024)
+                    if chunk.isEmpty {
+                        isAtEnd = true
+                        fileHandle.closeFile()
+                    } else {
+                        buffer.append(chunk)
+                    }
+                }
+            }
+        }
+    }
+    
+    /// Path of `url` relative to `rootPath`, without extension. Images outside of it keep their whole
+    /// path, so their outputs cannot collide either.
+    private static func name(of url: URL, relativeTo rootPath: String) -> String {
+        let path = url.standardizedFileURL.path
+        let prefix = rootPath.hasSuffix("/") ? rootPath : rootPath + "/"
+        let relativePath = path.hasPrefix(prefix) ? String(path.dropFirst(prefix.count)) : String(path.drop { $0 == "/" })
+        return (relativePath as NSString).deletingPathExtension
+    }
+}
+
+public struct BatchPipelineConfig {
+    public let decodeWorkers: Int
+    public let inferenceWorkers: Int
+    public let encodeWorkers: Int
+    /// Most images held by the pipeline at once, whatever stage they are in. Memory stays bounded by it
+    /// however many inputs there are.
+    public let maxImagesInFlight: Int
+    /// Images are decoded straight to this size, see `CryptonetPackage.downsampledImage(url:maxPixelSize:)`.
+    public let maxPixelSize: CGFloat
+    
+    /// `inferenceWorkers` above the `maxConcurrentCalls` of the session only wait for it.
+    public init(decodeWorkers: Int = ProcessInfo.processInfo.activeProcessorCount,
+         inferenceWorkers: Int = 1,
+         encodeWorkers: Int = 2,
+         maxImagesInFlight: Int = 2 * ProcessInfo.processInfo.activeProcessorCount,
+         maxPixelSize: CGFloat = 1000) {
+        self.decodeWorkers = max(1, decodeWorkers)
+        self.inferenceWorkers = max(1, inferenceWorkers)
+        self.encodeWorkers = max(1, encodeWorkers)
+        self.maxImagesInFlight = max(1, maxImagesInFlight)
+        self.maxPixelSize = maxPixelSize
+    }
+}
+
+public struct BatchProgress {
+    public internal(set) var completed = 0
+    public internal(set) var failed = 0
+    /// Inputs already done by an earlier run.
+    public internal(set) var skipped = 0
+    public internal(set) var elapsed: TimeInterval = 0
+    
+    /// Inputs processed per second, skipped ones excluded.
+    public var throughput: Double {
+        elapsed > 0 ? Double(completed + failed) / elapsed : 0
+    }
+}
+
+/// Runs an operation over a stream of image files. Decoding, the library call and encoding run on
+/// separate queues with their own worker counts, so the stages overlap instead of taking turns.
+public final class BatchPipeline {
+    private let cryptonet: CryptonetPackage
+    private let operation: BatchOperation
+    private let config: BatchPipelineConfig
+    
+    public init(cryptonet: CryptonetPackage, operation: BatchOperation, config: BatchPipelineConfig = BatchPipelineConfig()) {
+        self.cryptonet = cryptonet
+        self.operation = operation
+        self.config = config
+    }
+    
+    /// Processes every input and returns once all are done; call it off the main thread. The crop of
+    /// each input is written to `<name>.png` and the JSON result to `<name>.json` in `outputDirectory`.
+    /// The JSON is written last and atomically, so it marks the input as done: a later run into the same
+    /// directory skips it, which is how an interrupted job resumes. Failed inputs, including calls the
+    /// library returned a status of `0` or below for and crops that came back but could not be decoded,
+    /// are not marked and are tried again by the next run. `progress` is called after every input, one call at a time.
+    @discardableResult
+    public func run<Inputs: Sequence>(_ inputs: Inputs,
+                                      outputDirectory: URL,
+                                      progress: ((BatchProgress) -> Void)? = nil) -> BatchProgress where Inputs.Element == BatchInput {
+        let decodeQueue = makeQueue("decode", workers: config.decodeWorkers)
+        let inferenceQueue = makeQueue("inference", workers: config.inferenceWorkers)
+        let encodeQueue = makeQueue("encode", workers: config.encodeWorkers)
+        let slots = DispatchSemaphore(value: config.maxImagesInFlight)
+        let group = DispatchGroup()
+        
+        let start = DispatchTime.now()
+        let progressQueue = DispatchQueue(label: "com.privateid.cryptonet.batch.progress")
+        var current = BatchProgress()
+        
+        func report(_ update: @escaping (inout BatchProgress) -> Void) {
+            progressQueue.sync {
+                update(&current)
+                current.elapsed = TimeInterval(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds) / 1_000_000_000
+                progress?(current)
+            }
+        }
+        
+        func finish(succeeded: Bool) {
+            report { progress in
+                if succeeded {
+                    progress.completed += 1
+                } else {
+                    progress.failed += 1
+                }
+            }
+            slots.signal()
+            group.leave()
+        }
+        
+        for input in inputs {
+            let resultURL = outputDirectory.appendingPathComponent(input.name).appendingPathExtension("json")
+            if FileManager.default.fileExists(atPath: resultURL.path) {
+                report { $0.skipped += 1 }
+                continue
+            }
+            
+            slots.wait()
+            group.enter()
+            
+            decodeQueue.addOperation {
+                let image = autoreleasepool {
+                    CryptonetPackage.downsampledImage(url: input.url, maxPixelSize: self.config.maxPixelSize)
+                }
+                guard let image = image else { return finish(succeeded: false) }
+                
+                inferenceQueue.addOperation {
+                    let output = autoreleasepool { self.process(image) }
+                    guard let output = output else { return finish(succeeded: false) }
+                    
+                    encodeQueue.addOperation {
+                        let isWritten = autoreleasepool {
+                            self.write(json: output.json, crop: output.crop, resultURL: resultURL)
+                        }
+                        finish(succeeded: isWritten)
+                    }
+                }
+            }
+        }
+        
+        group.wait()
+        return progressQueue.sync { current }
+    }
+    
+    private func makeQueue(_ stage: String, workers: Int) -> OperationQueue {
+        let queue = OperationQueue()
+        queue.name = "com.privateid.cryptonet.batch.\(stage)"
+        queue.maxConcurrentOperationCount = workers
+        queue.qualityOfService = .utility
+        return queue
+    }
+    
+    private func process(_ image: UIImage) -> (json: String, crop: UIImage?)? {
+        switch operation {
+        case .faceIso(let config):
+            guard case .success(let model) = cryptonet.faceIso(image: image, config: config),
+                  isComplete(status: model.libraryStatus, hasUndecodableImage: model.hasUndecodableImage) else { return nil }
+            return (model.json, model.isoImage)
+        case .documentCrop(let config):
+            guard case .success(let model) = cryptonet.scanDocumentWithNoFace(image: image, config: config),
+                  isComplete(status: model.libraryStatus, hasUndecodableImage: model.hasUndecodableImage) else { return nil }
+            return (model.json, model.documentImage)
+        }
+    }
+    
+    /// A call the library reported as failed (status of `0` or below) is not written, so it is retried
+    /// like any other failed input.
+    private func isComplete(status: Int32?, hasUndecodableImage: Bool) -> Bool {
+        guard let status = status, status > 0 else { return false }
+        return !hasUndecodableImage
+    }
+    
+    private func write(json: String, crop: UIImage?, resultURL: URL) -> Bool {
+        do {
+            try FileManager.default.createDirectory(at: resultURL.deletingLastPathComponent(),
+                                                    withIntermediateDirectories: true)
+            if let pngData = crop?.pngData() {
+                try pngData.write(to: resultURL.deletingPathExtension().appendingPathExtension("png"))
+            }
+            try Data(json.utf8).write(to: resultURL, options: .atomic)
+            return true
+        } catch {
+            return false
+        }
+    }
+}
@@ -0,0 +1,144 @@
+import UIKit
+
+public struct ReplayResult {
+    public let operation: CryptonetOperation
+    public let recordedLatency: TimeInterval
+    /// Latency of the call during replay, `nil` when the call was skipped. It is timed around the whole
+    /// call, so unlike `recordedLatency` it includes converting the frames.
+    public let replayedLatency: TimeInterval?
+}
+
+public extension CryptonetPackage {
+    /// Writes every following library call to `url`: operation, configuration, latency, status and,
+    /// for each frame, its size and SHA-256. With `includesPixels` the RGBA frames sent to the library
+    /// are stored too, so the calls can be replayed. Replaces a capture that is already running.
+    func startRecording(to url: URL, includesPixels: Bool = false) throws {
+        let recorder = try CallRecorder(url: url, includesPixels: includesPixels)
+        let previous = statsRecorder.callRecorder
+        statsRecorder.callRecorder = recorder
+        previous?.close()
+    }
+    
+    func stopRecording() {
+        let recorder = statsRecorder.callRecorder
+        statsRecorder.callRecorder = nil
+        recorder?.close()
+    }
+    
+    /// Sends captured calls through this session again, in order, and reports the latency of each.
+    /// `enroll` and `userDelete` change what is stored for a user and are skipped, as are
+    /// `compareDocumentAndEmbeddings` (its embeddings are not captured) and calls captured without
+    /// pixels. With `paced` each call starts as long after the previous one as it did when captured.
+    func replay(_ calls: [CapturedCall], paced: Bool = false) -> [ReplayResult] {
+        var results: [ReplayResult] = []
+        // Captures time calls at their end, so the start of a call is its timestamp minus its latency.
+        var previousStart: (recorded: Date, replayed: DispatchTime)?
+        
+        for call in calls {
+            let recordedStart = call.timestamp.addingTimeInterval(-call.latency)
+            if paced, let previousStart = previousStart {
+                let elapsed = TimeInterval(DispatchTime.now().uptimeNanoseconds - previousStart.replayed.uptimeNanoseconds) / 1_000_000_000
+                let delay = recordedStart.timeIntervalSince(previousStart.recorded) - elapsed
+                if delay > 0 {
+                    Thread.sleep(forTimeInterval: delay)
+                }
+            }
+            previousStart = (recordedStart, DispatchTime.now())
+            
+            results.append(ReplayResult(operation: call.operation,
+                                        recordedLatency: call.latency,
+                                        replayedLatency: replayCall(call)))
+        }
+        
+        return results
+    }
+}
+
+private extension CryptonetPackage {
+    /// Makes the captured call again and returns how long it took, `nil` when it cannot be replayed.
+    func replayCall(_ call: CapturedCall) -> TimeInterval? {
+        let frames = call.images.map { framesFromCapturedPixels($0) }
+        guard !frames.isEmpty, !frames.contains(where: { $0 == nil }),
+              let config = call.config.data(using: .utf8) else {
+            return nil
+        }
+        let images = frames.flatMap { $0 ?? [] }
+        
+        let decoder = JSONDecoder()
+        let start = DispatchTime.now()
+        
+        switch call.operation {
+        case .validate:
+            guard let config = try? decoder.decode(ValidConfig.self, from: config) else { return nil }
+            _ = validate(image: images[0], config: config)
+        case .antispoofCheck:
+            guard let config = try? decoder.decode(AntispoofConfig.self, from: config) else { return nil }
+            _ = antispoofCheck(image: images[0], config: config)
+        case .predict:
+            guard let config = try? decoder.decode(PredictConfig.self, from: config) else { return nil }
+            _ = predict(images: images, config: config)
+        case .compareFaces:
+            guard images.count == 2,
+                  let config = try? decoder.decode(CompareFacesConfig.self, from: config) else { return nil }
+            _ = compareFaces(faceOne: images[0], faceTwo: images[1], config: config)
+        case .faceIso:
+            guard let config = try? decoder.decode(FaceIsoConfig.self, from: config) else { return nil }
+            _ = faceIso(image: images[0], config: config)
+        case .estimateAge:
+            guard let config = try? decoder.decode(EstimageAgeConfig.self, from: config) else { return nil }
+            _ = estimateAge(image: images[0], config: config)
+        case .frontDocumentScan:
+            guard let config = try? decoder.decode(DocumentFrontScanConfig.self, from: config) else { return nil }
+            _ = frontDocumentScan(image: images[0], config: config)
+        case .backDocumentScan:
+            guard let config = try? decoder.decode(DocumentBackScanConfig.self, from: config) else { return nil }
+            _ = backDocumentScan(image: images[0], config: config)
+        case .compareDocumentAndFace:
+            guard images.count == 2,
+                  let config = try? decoder.decode(DocumentAndFaceConfig.self, from: config) else { return nil }
+            _ = compareDocumentAndFace(documentImage: images[0], selfieImage: images[1], config: config)
+        case .scanDocumentWithNoFace:
+            guard let config = try? decoder.decode(DocumentNoFaceScanConfig.self, from: config) else { return nil }
+            _ = scanDocumentWithNoFace(image: images[0], config: config)
+        default:
+            // enroll, userDelete and compareDocumentAndEmbeddings.
+            return nil
+        }
+        
+        return TimeInterval(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds) / 1_000_000_000
+    }
+    
+    /// Multi-frame calls send their frames packed one after the other in a single buffer, which is
+    /// split back into one image per frame.
+    func framesFromCapturedPixels(_ image: CapturedImage) -> [UIImage]? {
+        let bytesPerPixel = 4
+        let frameLength = image.width * image.height * bytesPerPixel
+        
+        guard let pixels = image.pixels, frameLength > 0,
+              !pixels.isEmpty, pixels.count % frameLength == 0 else {
+            return nil
+        }
+        
+        var frames: [UIImage] = []
+        for offset in stride(from: 0, to: pixels.count, by: frameLength) {
+            let start = pixels.startIndex + offset
+            guard let provider = CGDataProvider(data: pixels.subdata(in: start..<start + frameLength) as CFData),
+                  let cgImage = CGImage(width: image.width,
+                                        height: image.height,
+                                        bitsPerComponent: 8,
+                                        bitsPerPixel: 8 * bytesPerPixel,
+                                        bytesPerRow: image.width * bytesPerPixel,
+                                        space: CGColorSpaceCreateDeviceRGB(),
+                                        bitmapInfo: CGBitmapInfo(rawValue: CGImageAlphaInfo.noneSkipLast.rawValue),
+                                        provider: provider,
+                                        decode: nil,
+                                        shouldInterpolate: false,
+                                        intent: .defaultIntent) else {
+                return nil
+            }
+            frames.append(UIImage(cgImage: cgImage))
+        }
+        
+        return frames
+    }
+}
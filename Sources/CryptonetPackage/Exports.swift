@@ -0,0 +1,5 @@
+// The umbrella module: every feature, plus capture replay and the batch pipeline that span them.
+@_exported import CryptonetCore
+@_exported import CryptonetFace
+@_exported import CryptonetAge
+@_exported import CryptonetDocument
@@ -1,7 +0,0 @@
-import UIKit
-
-public struct ScanModel {
-    public let json: String
-    public let documentImage: UIImage?
-    public let mugshotImage: UIImage?
-}
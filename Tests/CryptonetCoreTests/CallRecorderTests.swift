@@ -0,0 +1,83 @@
+import XCTest
+import CryptoKit
+@testable import CryptonetCore
+
+/// Writes captures with `CallRecorder` and reads them back with `CapturedCall.read(from:)`.
+final class CallRecorderTests: XCTestCase {
+    private var captureURL: URL!
+    
+    override func setUp() {
+        super.setUp()
+        captureURL = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString + ".cncap")
+    }
+    
+    override func tearDown() {
+        try? FileManager.default.removeItem(at: captureURL)
+        super.tearDown()
+    }
+    
+    func testRoundTripWithPixels() throws {
+        let first = RgbaRawBitmap(bytes: (0..<2 * 3 * 4).map { UInt8($0) }, width: 2, height: 3)
+        let second = RgbaRawBitmap(bytes: [UInt8](repeating: 0xAB, count: 1 * 1 * 4), width: 1, height: 1)
+        
+        let recorder = try CallRecorder(url: captureURL, includesPixels: true)
+        recorder.record(.validate, config: #"{"input_image_format":"rgba"}"#, images: [first], latency: 0.25, status: 7)
+        recorder.record(.compareFaces, config: "{}", images: [first, second], latency: 1.5, status: -100)
+        recorder.close()
+        
+        let calls = try CapturedCall.read(from: captureURL)
+        XCTAssertEqual(calls.count, 2)
+        
+        XCTAssertEqual(calls[0].operation, .validate)
+        XCTAssertEqual(calls[0].config, #"{"input_image_format":"rgba"}"#)
+        XCTAssertEqual(calls[0].latency, 0.25)
+        XCTAssertEqual(calls[0].status, 7)
+        XCTAssertEqual(calls[0].images.count, 1)
+        XCTAssertEqual(calls[0].images[0].width, 2)
+        XCTAssertEqual(calls[0].images[0].height, 3)
+        XCTAssertEqual(calls[0].images[0].sha256, Data(SHA256.hash(data: first.bytes)))
+        XCTAssertEqual(calls[0].images[0].pixels, Data(first.bytes))
+        
+        XCTAssertEqual(calls[1].operation, .compareFaces)
+        XCTAssertEqual(calls[1].status, -100)
+        XCTAssertEqual(calls[1].images.map(\.pixels), [Data(first.bytes), Data(second.bytes)])
+        XCTAssertLessThanOrEqual(calls[0].timestamp, calls[1].timestamp)
+    }
+    
+    func testRoundTripWithoutPixels() throws {
+        let bitmap = RgbaRawBitmap(bytes: [UInt8](repeating: 1, count: 4 * 4 * 4), width: 4, height: 4)
+        
+        let recorder = try CallRecorder(url: captureURL, includesPixels: false)
+        recorder.record(.estimateAge, config: "{}", images: [bitmap], latency: 0.1, status: 1)
+        recorder.record(.userDelete, config: "{}", images: [], latency: 0.2, status: 2)
+        recorder.close()
+        
+        let calls = try CapturedCall.read(from: captureURL)
+        XCTAssertEqual(calls.map(\.operation), [.estimateAge, .userDelete])
+        XCTAssertNil(calls[0].images[0].pixels)
+        XCTAssertEqual(calls[0].images[0].sha256, Data(SHA256.hash(data: bitmap.bytes)))
+        XCTAssertTrue(calls[1].images.isEmpty)
+    }
+    
+    func testRecordsAfterCloseAreDropped() throws {
+        let recorder = try CallRecorder(url: captureURL, includesPixels: false)
+        recorder.close()
+        recorder.record(.validate, config: "{}", images: [], latency: 0.1, status: 1)
+        recorder.close()
+        
+        XCTAssertTrue(try CapturedCall.read(from: captureURL).isEmpty)
+    }
+    
+    func testTruncatedCaptureIsRejected() throws {
+        let recorder = try CallRecorder(url: captureURL, includesPixels: false)
+        recorder.record(.validate, config: "{}", images: [], latency: 0.1, status: 1)
+        recorder.close()
+        
+        let data = try Data(contentsOf: captureURL)
+        try data.dropLast(3).write(to: captureURL)
+        XCTAssertThrowsError(try CapturedCall.read(from: captureURL))
+        
+        try Data("NOTACAPT".utf8).write(to: captureURL)
+        XCTAssertThrowsError(try CapturedCall.read(from: captureURL))
+    }
+}
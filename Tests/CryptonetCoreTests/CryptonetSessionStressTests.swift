@@ -0,0 +1,131 @@
+import XCTest
+import UIKit
+@testable import CryptonetCore
+import CryptonetFace
+
+/// Hammers one session from many threads. Run on the simulator slice of privid_fhe, e.g.
+/// `xcodebuild test -scheme CryptonetPackage-Package -destination 'platform=iOS Simulator,name=iPhone 15'`.
+/// The tests that load models need session settings in `CRYPTONET_TEST_SETTINGS`, passed to xcodebuild
+/// as `TEST_RUNNER_CRYPTONET_TEST_SETTINGS`; they are skipped without it. Calls only overlap on the
+/// session when `CRYPTONET_TEST_MAX_CONCURRENT_CALLS` is above 1, for library builds known to be reentrant.
+final class CryptonetSessionStressTests: XCTestCase {
+    private let threadCount = 8
+    private let callsPerThread = 25
+    
+    func testSlotsNeverExceedMaxConcurrentCalls() {
+        // Never opened or closed, so no library call is made on it.
+        let session = CryptonetSession(pointer: UnsafeMutableRawPointer(bitPattern: 0x1)!, maxConcurrentCalls: 3)
+        let lock = NSLock()
+        var running = 0
+        var maxRunning = 0
+        var refused = 0
+        
+        DispatchQueue.concurrentPerform(iterations: threadCount * callsPerThread * 4) { _ in
+            guard session.begin() else {
+                lock.lock()
+                refused += 1
+                lock.unlock()
+                return
+            }
+            
+            lock.lock()
+            running += 1
+            maxRunning = max(maxRunning, running)
+            lock.unlock()
+            
+            usleep(200)
+            
+            lock.lock()
+            running -= 1
+            lock.unlock()
+            session.end()
+        }
+        
+        XCTAssertEqual(refused, 0)
+        XCTAssertEqual(running, 0)
+        XCTAssertLessThanOrEqual(maxRunning, 3)
+    }
+    
+    /// At the default `maxConcurrentCalls` of 1 the calls of all threads are serialised on the session;
+    /// each must wait for its turn and succeed.
+    func testSerialisedCallsFromManyThreads() throws {
+        assertEveryCallSucceeds(on: try makeCryptonet())
+    }
+    
+    /// Calls overlap on the session, up to `CRYPTONET_TEST_MAX_CONCURRENT_CALLS` at a time.
+    func testOverlappingCallsOnOneSession() throws {
+        guard let value = ProcessInfo.processInfo.environment["CRYPTONET_TEST_MAX_CONCURRENT_CALLS"],
+              let maxConcurrentCalls = Int(value), maxConcurrentCalls > 1 else {
+            throw XCTSkip("CRYPTONET_TEST_MAX_CONCURRENT_CALLS is not set above 1")
+        }
+        assertEveryCallSucceeds(on: try makeCryptonet(maxConcurrentCalls: maxConcurrentCalls))
+    }
+    
+    private func assertEveryCallSucceeds(on cryptonet: CryptonetPackage) {
+        defer { _ = cryptonet.deinitializeSession() }
+        let image = makeImage()
+        
+        let lock = NSLock()
+        var failures = 0
+        
+        DispatchQueue.concurrentPerform(iterations: threadCount) { _ in
+            for _ in 0..<callsPerThread {
+                if case .failure = cryptonet.validate(image: image, config: ValidConfig()) {
+                    lock.lock()
+                    failures += 1
+                    lock.unlock()
+                }
+            }
+        }
+        
+        XCTAssertEqual(failures, 0)
+        XCTAssertEqual(cryptonet.stats(for: .validate).count, threadCount * callsPerThread)
+    }
+    
+    func testReinitializingWhileCalling() throws {
+        let settings = try testSettings()
+        let cryptonet = try makeCryptonet()
+        let image = makeImage()
+        
+        DispatchQueue.concurrentPerform(iterations: threadCount + 1) { index in
+            for iteration in 0..<callsPerThread {
+                if index == threadCount {
+                    // Replaces the session under the calls of the other threads, alternating shared and own sessions.
+                    XCTAssertTrue(cryptonet.initializeSession(settings: settings, shared: iteration % 2 == 0))
+                } else if case .failure(let error) = cryptonet.validate(image: image, config: ValidConfig()) {
+                    // Only a call that found the session being replaced may fail.
+                    XCTAssertEqual(error as? CryptonetError, .failed)
+                }
+            }
+        }
+        
+        XCTAssertEqual(try cryptonet.deinitializeSession().get(), true)
+        XCTAssertThrowsError(try cryptonet.deinitializeSession().get())
+    }
+    
+    private func testSettings() throws -> NSString {
+        guard let settings = ProcessInfo.processInfo.environment["CRYPTONET_TEST_SETTINGS"] else {
+            throw XCTSkip("CRYPTONET_TEST_SETTINGS is not set")
+        }
+        return NSString(string: settings)
+    }
+    
+    private func makeCryptonet(maxConcurrentCalls: Int = 1) throws -> CryptonetPackage {
+        let settings = try testSettings()
+        CryptonetPackage.initializeLib()
+        let cryptonet = CryptonetPackage()
+        guard cryptonet.initializeSession(settings: settings, maxConcurrentCalls: maxConcurrentCalls) else {
+            throw XCTSkip("The session could not be opened with CRYPTONET_TEST_SETTINGS")
+        }
+        return cryptonet
+    }
+    
+    private func makeImage() -> UIImage {
+        let format = UIGraphicsImageRendererFormat()
+        format.scale = 1
+        return UIGraphicsImageRenderer(size: CGSize(width: 640, height: 480), format: format).image { context in
+            UIColor.gray.setFill()
+            context.fill(CGRect(x: 0, y: 0, width: 640, height: 480))
+        }
+    }
+}
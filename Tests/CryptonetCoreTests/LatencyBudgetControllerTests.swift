@@ -0,0 +1,78 @@
+import XCTest
+@testable import CryptonetCore
+
+final class LatencyBudgetControllerTests: XCTestCase {
+    private let budget: TimeInterval = 0.1
+    
+    func testWithoutBudgetStaysAccurate() {
+        let controller = LatencyBudgetController()
+        for _ in 0..<10 {
+            controller.record(.validate, tier: .accurate, budget: nil, latency: 1)
+        }
+        
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .accurate)
+        XCTAssertEqual(controller.tier(for: .validate, budget: nil), .accurate)
+    }
+    
+    func testFirstCallIsIgnored() {
+        let controller = LatencyBudgetController()
+        controller.record(.validate, tier: .accurate, budget: budget, latency: 10)
+        
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .accurate)
+    }
+    
+    func testStepsDownWhileOverBudget() {
+        let controller = LatencyBudgetController()
+        controller.record(.validate, tier: .accurate, budget: budget, latency: 10)
+        
+        controller.record(.validate, tier: .accurate, budget: budget, latency: 0.3)
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .balanced)
+        
+        // Started before the change, so it does not count against the new tier.
+        controller.record(.validate, tier: .accurate, budget: budget, latency: 0.3)
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .balanced)
+        
+        controller.record(.validate, tier: .balanced, budget: budget, latency: 0.3)
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .fast)
+        
+        controller.record(.validate, tier: .fast, budget: budget, latency: 0.3)
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .fast)
+        
+        // Operations are tracked apart.
+        XCTAssertEqual(controller.tier(for: .estimateAge, budget: budget), .accurate)
+    }
+    
+    func testStepsBackUpOnceThereIsHeadroom() {
+        let controller = LatencyBudgetController()
+        controller.record(.validate, tier: .accurate, budget: budget, latency: 10)
+        controller.record(.validate, tier: .accurate, budget: budget, latency: 0.3)
+        controller.record(.validate, tier: .balanced, budget: budget, latency: 0.3)
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .fast)
+        
+        var tiers: [InputTier] = []
+        for _ in 0..<100 {
+            let tier = controller.tier(for: .validate, budget: budget)
+            if tiers.last != tier {
+                tiers.append(tier)
+            }
+            guard tier != .accurate else { break }
+            controller.record(.validate, tier: tier, budget: budget, latency: 0.01)
+        }
+        
+        XCTAssertEqual(tiers, [.fast, .balanced, .accurate])
+    }
+    
+    func testDoesNotStepUpWithoutHeadroom() {
+        let controller = LatencyBudgetController()
+        controller.record(.validate, tier: .accurate, budget: budget, latency: 10)
+        controller.record(.validate, tier: .accurate, budget: budget, latency: 0.3)
+        controller.record(.validate, tier: .balanced, budget: budget, latency: 0.3)
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .fast)
+        
+        // 0.06 at 640 px is expected to cost about 0.094 at 800 px, over 80% of the budget.
+        for _ in 0..<100 {
+            controller.record(.validate, tier: .fast, budget: budget, latency: 0.06)
+        }
+        XCTAssertEqual(controller.tier(for: .validate, budget: budget), .fast)
+    }
+}